@@ -4,6 +4,11 @@ endif()
 
 set(SWIFFT_DEFAULT_FILE_COMPILE_FLAGS "${SWIFFT_MACHINE_COMPILE_FLAGS}")
 
+# the library runs on any x86-64 platform, using instruction-set extensions only where selected at runtime
+if(NOT DEFINED SWIFFT_BASELINE_COMPILE_FLAGS)
+	set(SWIFFT_BASELINE_COMPILE_FLAGS -march=x86-64)
+endif()
+
 if(SWIFFT_ENABLE_OPENMP)
         find_package(OpenMP REQUIRED)
         if(OpenMP_FOUND)
@@ -12,3 +17,7 @@ if(SWIFFT_ENABLE_OPENMP)
                 set(CMAKE_EXE_LINKER_FLAGS "${CMAKE_EXE_LINKER_FLAGS} ${OpenMP_EXE_LINKER_FLAGS}")
         endif()
 endif()
+
+if(SWIFFT_ENABLE_SIGNED_FFT_TABLE)
+	add_compile_definitions(SWIFFT_SIGNED_LOOKUP=SWIFFT_LOOKUP_SIGNED_TABLE)
+endif()
@@ -12,10 +12,18 @@
  *   each 16-bit representing an element of Z_{257}.
  * - BitSequence[SWIFFT_COMPACT_BLOCK_SIZE] : Compact-form bits of the output
  *   of the SWIFFT function.
+ * - BitSequence[SWIFFT_COMPACT_CARRY_SIZE] : Carry bits of the compact-form,
+ *   which together with it make a lossless form of the output.
+ * - swifft_key_t : A SWIFFT key, for hashing with a key other than the built-in one.
  *
  * Use SWIFFT_ALIGN, an attribute macro, on each declaration of these data
  * structures. This will avoid segmentation faults due to incorrect memory
  * alignment for SIMD instructions.
+ *
+ * The functions of this API dispatch to the implementation for the best
+ * instruction-set supported by the running platform, selected once when the
+ * library is loaded. The selection can be queried and overridden using
+ * SWIFFT_GetIset and SWIFFT_SetIset.
  */
 
 #ifndef __LIBSWIFFT_SWIFFT_H__
@@ -31,6 +39,59 @@ LIBSWIFFT_BEGIN_EXTERN_C
 #include "libswifft/swifft_api.inl"
 #undef LIBSWIFFT_API
 
+//! \brief Returns the most advanced instruction-set supported by the running platform.
+//!
+//! \returns the instruction-set, or SWIFFT_ISET_NONE if none is supported.
+swifft_iset_t SWIFFT_GetBestIset(void);
+
+//! \brief Checks whether an instruction-set is supported by the running platform.
+//!
+//! \param[in] iset the instruction-set to check.
+//! \returns non-zero if supported, 0 otherwise.
+int SWIFFT_IsIsetSupported(swifft_iset_t iset);
+
+//! \brief Returns the instruction-set currently used by this API.
+//! Initially, this is the one returned by SWIFFT_GetBestIset.
+//!
+//! \returns the instruction-set, or SWIFFT_ISET_NONE if none is supported, in which case the rest of this API
+//! must not be used.
+swifft_iset_t SWIFFT_GetIset(void);
+
+//! \brief Selects the instruction-set to be used by this API.
+//! The selection applies to subsequent calls from all threads.
+//!
+//! \param[in] iset the instruction-set to select.
+//! \returns 0 on success, or -1 if the instruction-set is not supported by the running platform.
+int SWIFFT_SetIset(swifft_iset_t iset);
+
+//! \brief Returns the name of an instruction-set, e.g., "AVX2".
+//!
+//! \param[in] iset the instruction-set.
+//! \returns the name, or "NONE" for an unknown instruction-set.
+const char * SWIFFT_GetIsetName(swifft_iset_t iset);
+
+//! \brief Initializes a SWIFFT key from its elements.
+//! The element at index 64*i+j multiplies the j-th element of the FFT of the i-th 64 input bits,
+//! the same as for the built-in key.
+//!
+//! \param[out] key the SWIFFT key to initialize.
+//! \param[in] values the elements of the key, taken mod 257.
+void SWIFFT_KeyInit(swifft_key_t * key, const int16_t values[SWIFFT_KEY_SIZE]);
+
+//! \brief Allocates memory-aligned SWIFFT keys, to be initialized using SWIFFT_KeyInit.
+//! On request, the memory is aligned to a huge page and advised for huge pages where supported,
+//! to reduce TLB misses when hashing with many keys.
+//!
+//! \param[in] nkeys the number of keys to allocate.
+//! \param[in] hugePages non-zero for requesting huge pages.
+//! \returns the allocated keys, or NULL on failure.
+swifft_key_t * SWIFFT_KeyAlloc(int nkeys, int hugePages);
+
+//! \brief Frees SWIFFT keys allocated using SWIFFT_KeyAlloc.
+//!
+//! \param[in] keys the keys to free, or NULL.
+void SWIFFT_KeyFree(swifft_key_t * keys);
+
 LIBSWIFFT_END_EXTERN_C
 
 #endif /* __LIBSWIFFT_SWIFFT_H__ */
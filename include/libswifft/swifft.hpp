@@ -81,6 +81,38 @@ struct SWIFFT_ALIGN SwifftCompact {
 
 };
 
+//! \brief An auto-memory-aligned accumulator of SWIFFT outputs, summing them element-wise mod 257 with lazy reduction.
+struct SwifftAccumulator {
+	//! \brief The accumulator data structure.
+	swifft_accumulator_t data;
+
+	//! \brief Constructs an accumulator with a zero sum.
+	LIBSWIFFT_INLINE SwifftAccumulator() { SWIFFT_AccumulatorInit(&data); }
+	//! \brief Resets to a zero sum.
+	LIBSWIFFT_INLINE void Clear() { SWIFFT_AccumulatorInit(&data); }
+	//! \brief Gets the sum, reduced mod 257.
+	//!
+	//! \param[out] output the SWIFFT output to set to the sum.
+	LIBSWIFFT_INLINE void Get(SwifftOutput &output) const { SWIFFT_AccumulatorGet(&data, output.data); }
+
+};
+
+//! \brief An element-wise product of two SWIFFT output data structures, deferred for a fused multiply-add.
+struct SwifftProduct {
+	//! \brief The first SWIFFT output to multiply.
+	const SwifftOutput &lhs;
+	//! \brief The second SWIFFT output to multiply.
+	const SwifftOutput &rhs;
+};
+
+//! \brief A product of a SWIFFT output data structure by a value, deferred for a fused multiply-add.
+struct SwifftScaled {
+	//! \brief The SWIFFT output to multiply.
+	const SwifftOutput &operand;
+	//! \brief The value to multiply by.
+	int16_t value;
+};
+
 //! \brief Tests for equality of two SWIFFT input data structures.
 //!
 //! \param[in] si1 the first SWIFFT input.
@@ -248,6 +280,105 @@ LIBSWIFFT_INLINE SwifftOutput & operator*=(SwifftOutput &lhs, const SwifftOutput
 	return lhs;
 }
 
+//! \brief Defers the element-wise product of two SWIFFT output data structures, for use with operator+= or operator-=.
+//!
+//! \param[in] lhs the first SWIFFT output.
+//! \param[in] rhs the second SWIFFT output.
+//! \returns the deferred product.
+LIBSWIFFT_INLINE SwifftProduct operator*(const SwifftOutput &lhs, const SwifftOutput &rhs) {
+	return SwifftProduct{lhs, rhs};
+}
+
+//! \brief Defers the product of a SWIFFT output data structure by a value, for use with operator+= or operator-=.
+//!
+//! \param[in] lhs the SWIFFT output.
+//! \param[in] value the value.
+//! \returns the deferred product.
+LIBSWIFFT_INLINE SwifftScaled operator*(const SwifftOutput &lhs, const int16_t value) {
+	return SwifftScaled{lhs, value};
+}
+
+//! \brief Defers the product of a SWIFFT output data structure by a value, for use with operator+= or operator-=.
+//!
+//! \param[in] value the value.
+//! \param[in] rhs the SWIFFT output.
+//! \returns the deferred product.
+LIBSWIFFT_INLINE SwifftScaled operator*(const int16_t value, const SwifftOutput &rhs) {
+	return SwifftScaled{rhs, value};
+}
+
+//! \brief Adds a product of SWIFFT output data structures to a SWIFFT output data structure, element-wise, in one pass.
+//!
+//! \param[in,out] lhs the SWIFFT output.
+//! \param[in] rhs the deferred product.
+//! \returns the SWIFFT output.
+LIBSWIFFT_INLINE SwifftOutput & operator+=(SwifftOutput &lhs, const SwifftProduct &rhs) {
+	SWIFFT_MulAdd(lhs.data, rhs.lhs.data, rhs.rhs.data);
+	return lhs;
+}
+
+//! \brief Subtracts a product of SWIFFT output data structures from a SWIFFT output data structure, element-wise, in one pass.
+//!
+//! \param[in,out] lhs the SWIFFT output.
+//! \param[in] rhs the deferred product.
+//! \returns the SWIFFT output.
+LIBSWIFFT_INLINE SwifftOutput & operator-=(SwifftOutput &lhs, const SwifftProduct &rhs) {
+	SWIFFT_MulSub(lhs.data, rhs.lhs.data, rhs.rhs.data);
+	return lhs;
+}
+
+//! \brief Adds a product of a SWIFFT output data structure by a value to a SWIFFT output data structure, element-wise, in one pass.
+//!
+//! \param[in,out] lhs the SWIFFT output.
+//! \param[in] rhs the deferred product.
+//! \returns the SWIFFT output.
+LIBSWIFFT_INLINE SwifftOutput & operator+=(SwifftOutput &lhs, const SwifftScaled &rhs) {
+	SWIFFT_ConstMulAdd(lhs.data, rhs.operand.data, rhs.value);
+	return lhs;
+}
+
+//! \brief Subtracts a product of a SWIFFT output data structure by a value from a SWIFFT output data structure, element-wise, in one pass.
+//!
+//! \param[in,out] lhs the SWIFFT output.
+//! \param[in] rhs the deferred product.
+//! \returns the SWIFFT output.
+LIBSWIFFT_INLINE SwifftOutput & operator-=(SwifftOutput &lhs, const SwifftScaled &rhs) {
+	SWIFFT_ConstMulSub(lhs.data, rhs.operand.data, rhs.value);
+	return lhs;
+}
+
+//! \brief Sets a SWIFFT output data structure to a linear combination of SWIFFT output data structures, element-wise.
+//!
+//! \param[out] result the SWIFFT output to set.
+//! \param[in] n the number of terms.
+//! \param[in] coeffs the coefficients of the terms.
+//! \param[in] operands the SWIFFT outputs of the terms.
+//! \returns the SWIFFT output.
+LIBSWIFFT_INLINE SwifftOutput & LinearCombination(SwifftOutput &result, int n, const int16_t *coeffs, const SwifftOutput *operands) {
+	SWIFFT_LinearCombination(n, coeffs, reinterpret_cast<const BitSequence *>(operands), result.data);
+	return result;
+}
+
+//! \brief Adds a SWIFFT output data structure to a SWIFFT accumulator, element-wise, without reducing it.
+//!
+//! \param[in,out] lhs the SWIFFT accumulator.
+//! \param[in] rhs the SWIFFT output.
+//! \returns the SWIFFT accumulator.
+LIBSWIFFT_INLINE SwifftAccumulator & operator+=(SwifftAccumulator &lhs, const SwifftOutput &rhs) {
+	SWIFFT_AccumulatorAdd(&lhs.data, rhs.data);
+	return lhs;
+}
+
+//! \brief Subtracts a SWIFFT output data structure from a SWIFFT accumulator, element-wise, without reducing it.
+//!
+//! \param[in,out] lhs the SWIFFT accumulator.
+//! \param[in] rhs the SWIFFT output.
+//! \returns the SWIFFT accumulator.
+LIBSWIFFT_INLINE SwifftAccumulator & operator-=(SwifftAccumulator &lhs, const SwifftOutput &rhs) {
+	SWIFFT_AccumulatorSub(&lhs.data, rhs.data);
+	return lhs;
+}
+
 } // end namespace LibSwifft
 
 #endif // __LIBSWIFFT_SWIFFT_HPP__
@@ -67,6 +67,38 @@ void LIBSWIFFT_API(SWIFFT_Sub)(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
 void LIBSWIFFT_API(SWIFFT_Mul)(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
 	const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE]);
 
+//! \brief Adds the product of two SWIFFT hash values to another, element-wise.
+//!
+//! \param[in,out] output the hash value of SWIFFT to modify.
+//! \param[in] operand1 the first hash value to multiply.
+//! \param[in] operand2 the second hash value to multiply.
+void LIBSWIFFT_API(SWIFFT_MulAdd)(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
+	const BitSequence operand1[SWIFFT_OUTPUT_BLOCK_SIZE], const BitSequence operand2[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Subtracts the product of two SWIFFT hash values from another, element-wise.
+//!
+//! \param[in,out] output the hash value of SWIFFT to modify.
+//! \param[in] operand1 the first hash value to multiply.
+//! \param[in] operand2 the second hash value to multiply.
+void LIBSWIFFT_API(SWIFFT_MulSub)(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
+	const BitSequence operand1[SWIFFT_OUTPUT_BLOCK_SIZE], const BitSequence operand2[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Adds the product of a SWIFFT hash value and a constant value to another, element-wise.
+//!
+//! \param[in,out] output the hash value of SWIFFT to modify.
+//! \param[in] operand the hash value to multiply.
+//! \param[in] multiplier the constant value to multiply by.
+void LIBSWIFFT_API(SWIFFT_ConstMulAdd)(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
+	const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE], const int16_t multiplier);
+
+//! \brief Subtracts the product of a SWIFFT hash value and a constant value from another, element-wise.
+//!
+//! \param[in,out] output the hash value of SWIFFT to modify.
+//! \param[in] operand the hash value to multiply.
+//! \param[in] multiplier the constant value to multiply by.
+void LIBSWIFFT_API(SWIFFT_ConstMulSub)(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
+	const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE], const int16_t multiplier);
+
 //! \brief Sets a constant value at each SWIFFT hash value element for multiple blocks.
 //!
 //! \param[in] nblocks the number of blocks to operate on.
@@ -130,3 +162,245 @@ void LIBSWIFFT_API(SWIFFT_SubMultiple)(int nblocks, BitSequence * output,
 //! \param[in] operand the hash value to multiply by.
 void LIBSWIFFT_API(SWIFFT_MulMultiple)(int nblocks, BitSequence * output,
 	const BitSequence * operand);
+
+//! \brief Adds the product of two SWIFFT hash values to another, element-wise, for multiple blocks.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the hash value of SWIFFT to modify.
+//! \param[in] operand1 the first hash value to multiply.
+//! \param[in] operand2 the second hash value to multiply.
+void LIBSWIFFT_API(SWIFFT_MulAddMultiple)(int nblocks, BitSequence * output,
+	const BitSequence * operand1, const BitSequence * operand2);
+
+//! \brief Subtracts the product of two SWIFFT hash values from another, element-wise, for multiple blocks.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the hash value of SWIFFT to modify.
+//! \param[in] operand1 the first hash value to multiply.
+//! \param[in] operand2 the second hash value to multiply.
+void LIBSWIFFT_API(SWIFFT_MulSubMultiple)(int nblocks, BitSequence * output,
+	const BitSequence * operand1, const BitSequence * operand2);
+
+//! \brief Adds the product of a SWIFFT hash value and a constant value to another, element-wise, for multiple blocks.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the hash value of SWIFFT to modify, per block.
+//! \param[in] operand the hash value to multiply, per block.
+//! \param[in] multiplier the constant value to multiply by, per block.
+void LIBSWIFFT_API(SWIFFT_ConstMulAddMultiple)(int nblocks, BitSequence * output,
+	const BitSequence * operand, const int16_t * multiplier);
+
+//! \brief Subtracts the product of a SWIFFT hash value and a constant value from another, element-wise, for multiple blocks.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the hash value of SWIFFT to modify, per block.
+//! \param[in] operand the hash value to multiply, per block.
+//! \param[in] multiplier the constant value to multiply by, per block.
+void LIBSWIFFT_API(SWIFFT_ConstMulSubMultiple)(int nblocks, BitSequence * output,
+	const BitSequence * operand, const int16_t * multiplier);
+
+//! \brief Sets a SWIFFT hash value to another, element-wise, for multiple blocks with the same operand.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[out] output the hash value of SWIFFT to modify, per block.
+//! \param[in] operand the hash value to set to, for all blocks.
+void LIBSWIFFT_API(SWIFFT_SetBroadcast)(int nblocks, BitSequence * output,
+	const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Adds a SWIFFT hash value to another, element-wise, for multiple blocks with the same operand.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the hash value of SWIFFT to modify, per block.
+//! \param[in] operand the hash value to add, for all blocks.
+void LIBSWIFFT_API(SWIFFT_AddBroadcast)(int nblocks, BitSequence * output,
+	const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Subtracts a SWIFFT hash value from another, element-wise, for multiple blocks with the same operand.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the hash value of SWIFFT to modify, per block.
+//! \param[in] operand the hash value to subtract, for all blocks.
+void LIBSWIFFT_API(SWIFFT_SubBroadcast)(int nblocks, BitSequence * output,
+	const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Multiplies a SWIFFT hash value by another, element-wise, for multiple blocks with the same operand.
+//! The operand is centered once for all blocks.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the hash value of SWIFFT to modify, per block.
+//! \param[in] operand the hash value to multiply by, for all blocks.
+void LIBSWIFFT_API(SWIFFT_MulBroadcast)(int nblocks, BitSequence * output,
+	const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Sets SWIFFT hash values to the products of one SWIFFT hash value by constant values.
+//! The operand is centered once for all blocks, and each block of output is written without being read.
+//!
+//! \param[in] nblocks the number of blocks to operate on, one per constant value.
+//! \param[out] output the hash value of SWIFFT to set, per block.
+//! \param[in] operand the hash value to multiply, for all blocks.
+//! \param[in] multiplier the constant value to multiply by, per block.
+void LIBSWIFFT_API(SWIFFT_ConstMulOuter)(int nblocks, BitSequence * output,
+	const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE], const int16_t * multiplier);
+
+//! \brief Computes a linear combination of SWIFFT hash values, element-wise.
+//! The sum of products is accumulated into 32-bit elements and reduced mod 257 once.
+//!
+//! \param[in] n the number of terms.
+//! \param[in] coeffs the coefficients of the terms.
+//! \param[in] operand the hash value of each term, per block, with elements in the range {0,..,SWIFFT_P-1},
+//! as output by LibSWIFFT; other elements must first be canonicalized using SWIFFT_Canonicalize.
+//! \param[out] output the hash value of SWIFFT to set to the linear combination.
+void LIBSWIFFT_API(SWIFFT_LinearCombination)(int n, const int16_t * coeffs,
+	const BitSequence * operand, BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Computes linear combinations of SWIFFT hash values, element-wise, for multiple blocks.
+//! The linear combination for each output block has its own n coefficients and n operand blocks.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] n the number of terms per block.
+//! \param[in] coeffs the coefficients of the terms, n per block.
+//! \param[in] operand the hash value of each term, n blocks per block, with elements in the range {0,..,SWIFFT_P-1},
+//! as output by LibSWIFFT; other elements must first be canonicalized using SWIFFT_CanonicalizeMultiple.
+//! \param[out] output the hash value of SWIFFT to set to the linear combination, per block.
+void LIBSWIFFT_API(SWIFFT_LinearCombinationMultiple)(int nblocks, int n, const int16_t * coeffs,
+	const BitSequence * operand, BitSequence * output);
+
+//! \brief Multiplies a matrix by a vector of SWIFFT hash values, over Z_257.
+//! Computes output[i] = sum_j matrix[i*n+j]*operand[j], element-wise, for i in {0,..,k-1}.
+//!
+//! \param[in] k the number of rows of the matrix.
+//! \param[in] n the number of columns of the matrix.
+//! \param[in] matrix the matrix of k*n coefficients, in row-major order.
+//! \param[in] operand the vector of n hash values.
+//! \param[out] output the resulting vector of k hash values.
+void LIBSWIFFT_API(SWIFFT_MatMulOutputs)(int k, int n, const int16_t * matrix,
+	const BitSequence * operand, BitSequence * output);
+
+//! \brief Transforms a SWIFFT hash value from the evaluation form to the coefficient form.
+//! The i-th element of a hash value is the evaluation at OMEGA^(2i+1), for the 128-th root of unity OMEGA = 42,
+//! of a polynomial in Z_{257}[x]/(x^64+1), whose i-th coefficient becomes the i-th element.
+//!
+//! \param[in,out] output the hash value of SWIFFT to transform, of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_ToCoefficients)(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Transforms a SWIFFT hash value from the coefficient form to the evaluation form.
+//! The i-th coefficient of a polynomial in Z_{257}[x]/(x^64+1), given as the i-th element, becomes its evaluation at
+//! OMEGA^(2i+1), for the 128-th root of unity OMEGA = 42, the same as for hash values. This is the inverse of SWIFFT_ToCoefficients.
+//!
+//! \param[in,out] output the hash value of SWIFFT to transform, of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_FromCoefficients)(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Transforms multiple SWIFFT hash values from the evaluation form to the coefficient form.
+//! This is SWIFFT_ToCoefficients for each block.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the blocks of hash values of SWIFFT to transform, each of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_ToCoefficientsMultiple)(int nblocks, BitSequence * output);
+
+//! \brief Transforms multiple SWIFFT hash values from the coefficient form to the evaluation form.
+//! This is SWIFFT_FromCoefficients for each block.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the blocks of hash values of SWIFFT to transform, each of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_FromCoefficientsMultiple)(int nblocks, BitSequence * output);
+
+//! \brief Canonicalizes a SWIFFT hash value, reducing each element mod 257 to the range {0,..,SWIFFT_P-1}.
+//! Hash values computed by LibSWIFFT are canonical already; this is for elements coming from elsewhere, e.g. in the range of a partial reduction.
+//!
+//! \param[in,out] output the hash value of SWIFFT to canonicalize, of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_Canonicalize)(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Canonicalizes multiple SWIFFT hash values.
+//! This is SWIFFT_Canonicalize for each block.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the blocks of hash values of SWIFFT to canonicalize, each of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_CanonicalizeMultiple)(int nblocks, BitSequence * output);
+
+//! \brief Tests whether two SWIFFT hash values are equal.
+//! Elements are compared mod 257, so a non-canonical element compares equal to its canonical one.
+//!
+//! \param[in] operand1 the first hash value of SWIFFT, of size 128 bytes (1024 bit).
+//! \param[in] operand2 the second hash value of SWIFFT, of size 128 bytes (1024 bit).
+//! \returns 1 if the hash values are equal, 0 otherwise.
+int LIBSWIFFT_API(SWIFFT_Equal)(const BitSequence operand1[SWIFFT_OUTPUT_BLOCK_SIZE], const BitSequence operand2[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Tests whether pairs of SWIFFT hash values are equal for multiple blocks.
+//! This is SWIFFT_Equal for each pair of blocks, with the results packed into a bitmap.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] operand1 the first hash values of SWIFFT, of size 128 bytes (1024 bit) per block.
+//! \param[in] operand2 the second hash values of SWIFFT, of size 128 bytes (1024 bit) per block.
+//! \param[out] equal the bitmap of equality, of size ceil(nblocks/8) bytes, whose bit (i mod 8) of byte (i div 8) is set if and only if the i-th pair of blocks is equal.
+void LIBSWIFFT_API(SWIFFT_EqualMultiple)(int nblocks, const BitSequence * operand1, const BitSequence * operand2,
+	BitSequence * equal);
+
+//! \brief Finds the first of multiple SWIFFT hash values that is equal to a given one.
+//! Elements are compared mod 257, as in SWIFFT_Equal. The search stops at the first equal block.
+//!
+//! \param[in] nblocks the number of blocks to search.
+//! \param[in] haystack the hash values of SWIFFT to search, of size 128 bytes (1024 bit) per block.
+//! \param[in] needle the hash value of SWIFFT to search for, of size 128 bytes (1024 bit).
+//! \returns the index of the first equal block, or -1 if none is equal.
+int LIBSWIFFT_API(SWIFFT_FindMatch)(int nblocks, const BitSequence * haystack,
+	const BitSequence needle[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Sums SWIFFT hash values of multiple blocks, element-wise.
+//! Partial sums are accumulated with lazy reduction, in parallel when built with OpenMP.
+//!
+//! \param[in] nblocks the number of blocks to sum.
+//! \param[in] operand the hash value to sum, per block, with elements in the range {0,..,SWIFFT_P-1}.
+//! \param[out] output the hash value of SWIFFT to set to the sum.
+void LIBSWIFFT_API(SWIFFT_SumMultiple)(int nblocks, const BitSequence * operand,
+	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Multiplies SWIFFT hash values of multiple blocks, element-wise.
+//! Partial products are computed in parallel when built with OpenMP.
+//!
+//! \param[in] nblocks the number of blocks to multiply.
+//! \param[in] operand the hash value to multiply, per block, with elements in the range {0,..,SWIFFT_P-1}.
+//! \param[out] output the hash value of SWIFFT to set to the product.
+void LIBSWIFFT_API(SWIFFT_ProductMultiple)(int nblocks, const BitSequence * operand,
+	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Initializes a SWIFFT accumulator to a zero sum.
+//!
+//! \param[out] accumulator the SWIFFT accumulator to initialize.
+void LIBSWIFFT_API(SWIFFT_AccumulatorInit)(swifft_accumulator_t * accumulator);
+
+//! \brief Adds a SWIFFT hash value to a SWIFFT accumulator, element-wise, without reducing it.
+//!
+//! \param[in,out] accumulator the SWIFFT accumulator to modify.
+//! \param[in] operand the hash value to add, with elements in the range {0,..,SWIFFT_P-1}.
+void LIBSWIFFT_API(SWIFFT_AccumulatorAdd)(swifft_accumulator_t * accumulator,
+	const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Subtracts a SWIFFT hash value from a SWIFFT accumulator, element-wise, without reducing it.
+//!
+//! \param[in,out] accumulator the SWIFFT accumulator to modify.
+//! \param[in] operand the hash value to subtract, with elements in the range {0,..,SWIFFT_P-1}.
+void LIBSWIFFT_API(SWIFFT_AccumulatorSub)(swifft_accumulator_t * accumulator,
+	const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Adds SWIFFT hash values of multiple blocks to a SWIFFT accumulator, element-wise, without reducing it.
+//!
+//! \param[in,out] accumulator the SWIFFT accumulator to modify.
+//! \param[in] nblocks the number of blocks to add.
+//! \param[in] operand the hash value to add, per block, with elements in the range {0,..,SWIFFT_P-1}.
+void LIBSWIFFT_API(SWIFFT_AccumulatorAddMultiple)(swifft_accumulator_t * accumulator, int nblocks,
+	const BitSequence * operand);
+
+//! \brief Subtracts SWIFFT hash values of multiple blocks from a SWIFFT accumulator, element-wise, without reducing it.
+//!
+//! \param[in,out] accumulator the SWIFFT accumulator to modify.
+//! \param[in] nblocks the number of blocks to subtract.
+//! \param[in] operand the hash value to subtract, per block, with elements in the range {0,..,SWIFFT_P-1}.
+void LIBSWIFFT_API(SWIFFT_AccumulatorSubMultiple)(swifft_accumulator_t * accumulator, int nblocks,
+	const BitSequence * operand);
+
+//! \brief Gets the sum of a SWIFFT accumulator as a SWIFFT hash value, reduced mod 257.
+//!
+//! \param[in] accumulator the SWIFFT accumulator.
+//! \param[out] output the hash value of SWIFFT to set to the sum.
+void LIBSWIFFT_API(SWIFFT_AccumulatorGet)(const swifft_accumulator_t * accumulator,
+	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
@@ -11,12 +11,8 @@
 #ifndef __LIBSWIFFT_SWIFFT_AVX_H_
 #define __LIBSWIFFT_SWIFFT_AVX_H_
 
-#if defined(__AVX__)
-	#undef SWIFFT_ISET
-        #define SWIFFT_ISET() AVX
-        #include "libswifft/swifft_iset.inl"
-#else
-        #pragma message "LibSWIFFT API for AVX is disabled"
-#endif
+#undef SWIFFT_ISET
+#define SWIFFT_ISET() AVX
+#include "libswifft/swifft_iset.inl"
 
 #endif /* __LIBSWIFFT_SWIFFT_AVX_H_ */
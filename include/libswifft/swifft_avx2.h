@@ -11,12 +11,8 @@
 #ifndef __LIBSWIFFT_SWIFFT_AVX2_H_
 #define __LIBSWIFFT_SWIFFT_AVX2_H_
 
-#if defined(__AVX2__)
-	#undef SWIFFT_ISET
-        #define SWIFFT_ISET() AVX2
-        #include "libswifft/swifft_iset.inl"
-#else
-        #pragma message "LibSWIFFT API for AVX2 is disabled"
-#endif
+#undef SWIFFT_ISET
+#define SWIFFT_ISET() AVX2
+#include "libswifft/swifft_iset.inl"
 
 #endif /* __LIBSWIFFT_SWIFFT_AVX2_H_ */
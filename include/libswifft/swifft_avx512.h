@@ -11,12 +11,8 @@
 #ifndef __LIBSWIFFT_SWIFFT_AVX512_H_
 #define __LIBSWIFFT_SWIFFT_AVX512_H_
 
-#if defined(__AVX512F__)
-	#undef SWIFFT_ISET
-        #define SWIFFT_ISET() AVX512
-        #include "libswifft/swifft_iset.inl"
-#else
-        #pragma message "LibSWIFFT API for AVX512 is disabled"
-#endif
+#undef SWIFFT_ISET
+#define SWIFFT_ISET() AVX512
+#include "libswifft/swifft_iset.inl"
 
 #endif /* __LIBSWIFFT_SWIFFT_AVX512_H_ */
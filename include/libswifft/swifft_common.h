@@ -27,10 +27,54 @@ typedef unsigned char BitSequence; ///< Basic buffer type
 //! The size in bytes of SWIFFT input.
 #define SWIFFT_INPUT_BLOCK_SIZE 256
 
+//! The size in bytes of SWIFFT short input of 128 bytes.
+#define SWIFFT_INPUT_BLOCK_SIZE_128 128
+
+//! The size in bytes of SWIFFT short input of 64 bytes.
+#define SWIFFT_INPUT_BLOCK_SIZE_64 64
+
 //! The size in bytes of SWIFFT output block.
 #define SWIFFT_OUTPUT_BLOCK_SIZE 128
 
 //! The size in bytes of SWIFFT compact-form.
 #define SWIFFT_COMPACT_BLOCK_SIZE 64
 
+//! The size in bytes of the carry bits of SWIFFT compact-form, which make it lossless.
+#define SWIFFT_COMPACT_CARRY_SIZE 1
+
+//! The number of elements of a SWIFFT key, each in Z_{257}.
+#define SWIFFT_KEY_SIZE 2048
+
+//! The number of layouts of a SWIFFT key, one for each width of the vectors of the instruction-sets.
+#define SWIFFT_KEY_LAYOUTS 3
+
+//! The size in bytes of a seed from which a SWIFFT key is derived.
+#define SWIFFT_KEY_SEED_SIZE 32
+
+//! \brief A SWIFFT key, for hashing with a key other than the built-in one.
+//! The key is kept centered, in the layout used by each instruction-set, so that hashing with it
+//! is as fast as with the built-in key, whichever instruction-set is used. Initialize it using SWIFFT_KeyInit.
+typedef struct {
+	int16_t layouts[SWIFFT_KEY_LAYOUTS*SWIFFT_KEY_SIZE] SWIFFT_ALIGN; ///< The centered key, in the layout for each width of vectors
+} swifft_key_t;
+
+//! \brief An accumulator of SWIFFT hash values, summing them element-wise mod 257 with lazy reduction.
+//! The sum is kept unreduced in 16-bit elements, along with bounds on these, and is reduced only
+//! when accumulating might overflow an element or when the sum is read.
+typedef struct {
+	BitSequence sum[SWIFFT_OUTPUT_BLOCK_SIZE] SWIFFT_ALIGN; ///< The unreduced sum, each 16-bit representing an element of Z_{257}
+	int32_t low;  ///< A lower bound on the elements of the unreduced sum
+	int32_t high; ///< An upper bound on the elements of the unreduced sum
+} swifft_accumulator_t;
+
+//! \brief Instruction-sets having an implementation of the SWIFFT APIs.
+//! Larger values denote more advanced instruction-sets.
+typedef enum {
+	SWIFFT_ISET_NONE = 0,   ///< No instruction-set having an implementation
+	SWIFFT_ISET_AVX = 1,    ///< AVX instruction-set
+	SWIFFT_ISET_AVX2 = 2,   ///< AVX2 instruction-set
+	SWIFFT_ISET_AVX512 = 3, ///< AVX512F instruction-set
+	SWIFFT_ISET_AVX512BW = 4 ///< AVX512F, AVX512BW, and AVX512VL instruction-sets
+} swifft_iset_t;
+
 #endif /* __LIBSWIFFT_SWIFFT_COMMON_H__ */
@@ -28,6 +28,64 @@ void LIBSWIFFT_API(SWIFFT_Compact)(const BitSequence output[SWIFFT_OUTPUT_BLOCK_
 void LIBSWIFFT_API(SWIFFT_CompactMultiple)(int nblocks, const BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
 	BitSequence compact[SWIFFT_COMPACT_BLOCK_SIZE]);
 
+//! \brief Compacts a hash value of SWIFFT, keeping the carry bits dropped by SWIFFT_Compact.
+//! Together with its carry bits, the compacted hash value is lossless, and SWIFFT_Decompact recovers the hash value from them.
+//!
+//! \param[in] output the hash value of SWIFFT, of size 128 bytes (1024 bit).
+//! \param[out] compact the compacted hash value of SWIFFT, of size 64 bytes (512 bit).
+//! \param[out] carry the carry bits of the compacted hash value, of size 1 byte (8 bit).
+void LIBSWIFFT_API(SWIFFT_CompactWithCarry)(const BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
+	BitSequence compact[SWIFFT_COMPACT_BLOCK_SIZE], BitSequence carry[SWIFFT_COMPACT_CARRY_SIZE]);
+
+//! \brief Compacts a hash value of SWIFFT, keeping the carry bits, for multiple blocks.
+//! The carry bits of all blocks are kept apart from the compacted hash values, so the latter are the same as by SWIFFT_CompactMultiple.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] output the hash value of SWIFFT, of size 128 bytes (1024 bit) per block.
+//! \param[out] compact the compacted hash value of SWIFFT, of size 64 bytes (512 bit) per block.
+//! \param[out] carry the carry bits of the compacted hash value, of size 1 byte (8 bit) per block.
+void LIBSWIFFT_API(SWIFFT_CompactWithCarryMultiple)(int nblocks, const BitSequence * output,
+	BitSequence * compact, BitSequence * carry);
+
+//! \brief Decompacts a compacted hash value of SWIFFT, given with its carry bits, back to the hash value.
+//! This is the inverse of SWIFFT_CompactWithCarry. The elements of the hash value are canonical, in the range {0,..,SWIFFT_P-1}.
+//!
+//! \param[in] compact the compacted hash value of SWIFFT, of size 64 bytes (512 bit).
+//! \param[in] carry the carry bits of the compacted hash value, of size 1 byte (8 bit).
+//! \param[out] output the hash value of SWIFFT, of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_Decompact)(const BitSequence compact[SWIFFT_COMPACT_BLOCK_SIZE],
+	const BitSequence carry[SWIFFT_COMPACT_CARRY_SIZE], BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Decompacts a compacted hash value of SWIFFT, given with its carry bits, for multiple blocks.
+//! This is the inverse of SWIFFT_CompactWithCarryMultiple.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] compact the compacted hash value of SWIFFT, of size 64 bytes (512 bit) per block.
+//! \param[in] carry the carry bits of the compacted hash value, of size 1 byte (8 bit) per block.
+//! \param[out] output the hash value of SWIFFT, of size 128 bytes (1024 bit) per block.
+void LIBSWIFFT_API(SWIFFT_DecompactMultiple)(int nblocks, const BitSequence * compact,
+	const BitSequence * carry, BitSequence * output);
+
+//! \brief Tests whether pairs of compacted SWIFFT hash values are equal for multiple blocks.
+//! Compacted hash values are canonical, so they are compared bitwise.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] compact1 the first compacted hash values of SWIFFT, of size 64 bytes (512 bit) per block.
+//! \param[in] compact2 the second compacted hash values of SWIFFT, of size 64 bytes (512 bit) per block.
+//! \param[out] equal the bitmap of equality, of size ceil(nblocks/8) bytes, whose bit (i mod 8) of byte (i div 8) is set if and only if the i-th pair of blocks is equal.
+void LIBSWIFFT_API(SWIFFT_CompactEqualMultiple)(int nblocks, const BitSequence * compact1, const BitSequence * compact2,
+	BitSequence * equal);
+
+//! \brief Finds the first of multiple compacted SWIFFT hash values that is equal to a given one.
+//! The search stops at the first equal block.
+//!
+//! \param[in] nblocks the number of blocks to search.
+//! \param[in] haystack the compacted hash values of SWIFFT to search, of size 64 bytes (512 bit) per block.
+//! \param[in] needle the compacted hash value of SWIFFT to search for, of size 64 bytes (512 bit).
+//! \returns the index of the first equal block, or -1 if none is equal.
+int LIBSWIFFT_API(SWIFFT_FindCompactMatch)(int nblocks, const BitSequence * haystack,
+	const BitSequence needle[SWIFFT_COMPACT_BLOCK_SIZE]);
+
 //! \brief Computes the result of a SWIFFT operation.
 //! The result is composable with other hash values.
 //!
@@ -63,3 +121,426 @@ void LIBSWIFFT_API(SWIFFT_ComputeMultiple)(int nblocks, const BitSequence * inpu
 //! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
 void LIBSWIFFT_API(SWIFFT_ComputeMultipleSigned)(int nblocks, const BitSequence * input,
 	const BitSequence * sign, BitSequence * output);
+
+//! \brief Computes the result of a SWIFFT operation with a given key.
+//! The result is composable with other hash values computed with the same key.
+//!
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the input of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_ComputeKeyed)(const swifft_key_t * key, const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE],
+	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Computes the result of a SWIFFT operation with a given key.
+//! The result is composable with other hash values computed with the same key.
+//!
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the input of 256 bytes (2048 bit).
+//! \param[in] sign the sign bits corresponding to the input of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_ComputeSignedKeyed)(const swifft_key_t * key, const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE],
+	const BitSequence sign[SWIFFT_INPUT_BLOCK_SIZE], BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Computes the result of multiple SWIFFT operations with a given key.
+//! The result is composable with other hash values computed with the same key.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_ComputeMultipleKeyed)(int nblocks, const swifft_key_t * key, const BitSequence * input,
+	BitSequence * output);
+
+//! \brief Computes the result of multiple SWIFFT operations with a given key.
+//! The result is composable with other hash values computed with the same key.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 256 bytes (2048 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_ComputeMultipleSignedKeyed)(int nblocks, const swifft_key_t * key, const BitSequence * input,
+	const BitSequence * sign, BitSequence * output);
+
+//! \brief Computes the results of a SWIFFT operation with multiple keys.
+//! The results are the same as of SWIFFT_ComputeKeyed with each key, but the FFT phase is computed once.
+//!
+//! \param[in] nkeys the number of keys.
+//! \param[in] keys the SWIFFT keys, initialized using SWIFFT_KeyInit.
+//! \param[in] input the input of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash values of SWIFFT, one for each key, each of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_ComputeMultiKey)(int nkeys, const swifft_key_t * keys, const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE],
+	BitSequence * output);
+
+//! \brief Computes the results of a SWIFFT operation with multiple keys.
+//! The results are the same as of SWIFFT_ComputeSignedKeyed with each key, but the FFT phase is computed once.
+//!
+//! \param[in] nkeys the number of keys.
+//! \param[in] keys the SWIFFT keys, initialized using SWIFFT_KeyInit.
+//! \param[in] input the input of 256 bytes (2048 bit).
+//! \param[in] sign the sign bits corresponding to the input of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash values of SWIFFT, one for each key, each of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_ComputeSignedMultiKey)(int nkeys, const swifft_key_t * keys, const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE],
+	const BitSequence sign[SWIFFT_INPUT_BLOCK_SIZE], BitSequence * output);
+
+//! \brief Computes the results of multiple SWIFFT operations with multiple keys.
+//! The results are the same as of SWIFFT_ComputeMultipleKeyed with each key, but the FFT phase is computed
+//! once per block, and the blocks are processed in groups whose FFT-outputs stay in the L1 cache across keys.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] nkeys the number of keys.
+//! \param[in] keys the SWIFFT keys, initialized using SWIFFT_KeyInit.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, for each block of input one for each key, each of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_ComputeMultipleMultiKey)(int nblocks, int nkeys, const swifft_key_t * keys, const BitSequence * input,
+	BitSequence * output);
+
+//! \brief Computes the results of multiple SWIFFT operations with multiple keys.
+//! The results are the same as of SWIFFT_ComputeMultipleSignedKeyed with each key, but the FFT phase is computed
+//! once per block, and the blocks are processed in groups whose FFT-outputs stay in the L1 cache across keys.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] nkeys the number of keys.
+//! \param[in] keys the SWIFFT keys, initialized using SWIFFT_KeyInit.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 256 bytes (2048 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, for each block of input one for each key, each of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_ComputeMultipleSignedMultiKey)(int nblocks, int nkeys, const swifft_key_t * keys, const BitSequence * input,
+	const BitSequence * sign, BitSequence * output);
+
+//! \brief Derives a SWIFFT key from a seed.
+//! The elements of the key are sampled uniformly by rejection from the 16-bit little-endian words of the
+//! ChaCha20 keystream, as specified in RFC 8439, keyed by the seed with a zero nonce and a block counter
+//! starting at 0. A word w other than 65535 is sampled as the element w mod 257, in the order of SWIFFT_KeyInit.
+//! The derived key is the same for all instruction-sets.
+//!
+//! \param[in] seed the seed of 32 bytes (256 bit).
+//! \param[out] key the SWIFFT key to derive.
+void LIBSWIFFT_API(SWIFFT_DeriveKey)(const BitSequence seed[SWIFFT_KEY_SEED_SIZE], swifft_key_t * key);
+
+//! \brief Computes the result of a SWIFFT operation on a short input.
+//! The result is the same as for the input padded with zeros to 256 bytes.
+//!
+//! \param[in] input the input of 128 bytes (1024 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_Compute128)(const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE_128],
+	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Computes the result of a SWIFFT operation on a short input.
+//! The result is the same as for the input and sign bits padded with zeros to 256 bytes.
+//!
+//! \param[in] input the input of 128 bytes (1024 bit).
+//! \param[in] sign the sign bits corresponding to the input of 128 bytes (1024 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_ComputeSigned128)(const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE_128],
+	const BitSequence sign[SWIFFT_INPUT_BLOCK_SIZE_128],
+	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Computes the result of multiple SWIFFT operations on short inputs.
+//! The result is the same as for the inputs padded with zeros to 256 bytes.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] input the blocks of input, each of 128 bytes (1024 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_ComputeMultiple128)(int nblocks, const BitSequence * input, BitSequence * output);
+
+//! \brief Computes the result of multiple SWIFFT operations on short inputs.
+//! The result is the same as for the inputs and sign bits padded with zeros to 256 bytes.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] input the blocks of input, each of 128 bytes (1024 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 128 bytes (1024 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_ComputeMultipleSigned128)(int nblocks, const BitSequence * input,
+	const BitSequence * sign, BitSequence * output);
+
+//! \brief Computes the result of a SWIFFT operation on a short input.
+//! The result is the same as for the input padded with zeros to 256 bytes.
+//!
+//! \param[in] input the input of 64 bytes (512 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_Compute64)(const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE_64],
+	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Computes the result of a SWIFFT operation on a short input.
+//! The result is the same as for the input and sign bits padded with zeros to 256 bytes.
+//!
+//! \param[in] input the input of 64 bytes (512 bit).
+//! \param[in] sign the sign bits corresponding to the input of 64 bytes (512 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_ComputeSigned64)(const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE_64],
+	const BitSequence sign[SWIFFT_INPUT_BLOCK_SIZE_64],
+	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Computes the result of multiple SWIFFT operations on short inputs.
+//! The result is the same as for the inputs padded with zeros to 256 bytes.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] input the blocks of input, each of 64 bytes (512 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_ComputeMultiple64)(int nblocks, const BitSequence * input, BitSequence * output);
+
+//! \brief Computes the result of multiple SWIFFT operations on short inputs.
+//! The result is the same as for the inputs and sign bits padded with zeros to 256 bytes.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] input the blocks of input, each of 64 bytes (512 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 64 bytes (512 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_ComputeMultipleSigned64)(int nblocks, const BitSequence * input,
+	const BitSequence * sign, BitSequence * output);
+
+//! \brief Computes the result of a SWIFFT operation on a short input with a given key.
+//! The result is the same as of SWIFFT_ComputeKeyed for the input padded with zeros to 256 bytes.
+//!
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the input of 128 bytes (1024 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_Compute128Keyed)(const swifft_key_t * key, const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE_128],
+	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Computes the result of a SWIFFT operation on a short input with a given key.
+//! The result is the same as of SWIFFT_ComputeSignedKeyed for the input padded with zeros to 256 bytes.
+//!
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the input of 128 bytes (1024 bit).
+//! \param[in] sign the sign bits corresponding to the input of 128 bytes (1024 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_ComputeSigned128Keyed)(const swifft_key_t * key, const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE_128],
+	const BitSequence sign[SWIFFT_INPUT_BLOCK_SIZE_128], BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Computes the result of multiple SWIFFT operations on short inputs with a given key.
+//! The result is the same as of SWIFFT_ComputeMultipleKeyed for the inputs padded with zeros to 256 bytes.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the blocks of input, each of 128 bytes (1024 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_ComputeMultiple128Keyed)(int nblocks, const swifft_key_t * key, const BitSequence * input,
+	BitSequence * output);
+
+//! \brief Computes the result of multiple SWIFFT operations on short inputs with a given key.
+//! The result is the same as of SWIFFT_ComputeMultipleSignedKeyed for the inputs padded with zeros to 256 bytes.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the blocks of input, each of 128 bytes (1024 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 128 bytes (1024 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_ComputeMultipleSigned128Keyed)(int nblocks, const swifft_key_t * key, const BitSequence * input,
+	const BitSequence * sign, BitSequence * output);
+
+//! \brief Computes the result of a SWIFFT operation on a short input with a given key.
+//! The result is the same as of SWIFFT_ComputeKeyed for the input padded with zeros to 256 bytes.
+//!
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the input of 64 bytes (512 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_Compute64Keyed)(const swifft_key_t * key, const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE_64],
+	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Computes the result of a SWIFFT operation on a short input with a given key.
+//! The result is the same as of SWIFFT_ComputeSignedKeyed for the input padded with zeros to 256 bytes.
+//!
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the input of 64 bytes (512 bit).
+//! \param[in] sign the sign bits corresponding to the input of 64 bytes (512 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_ComputeSigned64Keyed)(const swifft_key_t * key, const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE_64],
+	const BitSequence sign[SWIFFT_INPUT_BLOCK_SIZE_64], BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Computes the result of multiple SWIFFT operations on short inputs with a given key.
+//! The result is the same as of SWIFFT_ComputeMultipleKeyed for the inputs padded with zeros to 256 bytes.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the blocks of input, each of 64 bytes (512 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_ComputeMultiple64Keyed)(int nblocks, const swifft_key_t * key, const BitSequence * input,
+	BitSequence * output);
+
+//! \brief Computes the result of multiple SWIFFT operations on short inputs with a given key.
+//! The result is the same as of SWIFFT_ComputeMultipleSignedKeyed for the inputs padded with zeros to 256 bytes.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the blocks of input, each of 64 bytes (512 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 64 bytes (512 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_ComputeMultipleSigned64Keyed)(int nblocks, const swifft_key_t * key, const BitSequence * input,
+	const BitSequence * sign, BitSequence * output);
+
+//! \brief Computes the sum of the results of SWIFFT operations for multiple blocks.
+//! The result is the same as summing the results of SWIFFT_ComputeMultiple, but faster.
+//!
+//! \param[in] nblocks the number of blocks to sum.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_ComputeSum)(int nblocks, const BitSequence * input,
+	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Computes the sum of the results of SWIFFT operations for multiple blocks.
+//! The result is the same as summing the results of SWIFFT_ComputeMultipleSigned, but faster.
+//!
+//! \param[in] nblocks the number of blocks to sum.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_ComputeSumSigned)(int nblocks, const BitSequence * input,
+	const BitSequence * sign, BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Computes a linear combination of the results of SWIFFT operations for multiple blocks.
+//! The result is the same as SWIFFT_LinearCombination of the results of SWIFFT_ComputeMultiple, but faster.
+//!
+//! \param[in] nblocks the number of blocks to combine.
+//! \param[in] coeffs the coefficients of the blocks.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_ComputeLinearCombination)(int nblocks, const int16_t * coeffs,
+	const BitSequence * input, BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Computes a linear combination of the results of SWIFFT operations for multiple blocks.
+//! The result is the same as SWIFFT_LinearCombination of the results of SWIFFT_ComputeMultipleSigned, but faster.
+//!
+//! \param[in] nblocks the number of blocks to combine.
+//! \param[in] coeffs the coefficients of the blocks.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_ComputeLinearCombinationSigned)(int nblocks, const int16_t * coeffs,
+	const BitSequence * input, const BitSequence * sign, BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Computes the sum of the results of SWIFFT operations with a given key for multiple blocks.
+//! The result is the same as summing the results of SWIFFT_ComputeMultipleKeyed, but faster.
+//!
+//! \param[in] nblocks the number of blocks to sum.
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_ComputeSumKeyed)(int nblocks, const swifft_key_t * key, const BitSequence * input,
+	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Computes the sum of the results of SWIFFT operations with a given key for multiple blocks.
+//! The result is the same as summing the results of SWIFFT_ComputeMultipleSignedKeyed, but faster.
+//!
+//! \param[in] nblocks the number of blocks to sum.
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_ComputeSumSignedKeyed)(int nblocks, const swifft_key_t * key, const BitSequence * input,
+	const BitSequence * sign, BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Computes a linear combination of the results of SWIFFT operations with a given key for multiple blocks.
+//! The result is the same as SWIFFT_LinearCombination of the results of SWIFFT_ComputeMultipleKeyed, but faster.
+//!
+//! \param[in] nblocks the number of blocks to combine.
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] coeffs the coefficients of the blocks.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_ComputeLinearCombinationKeyed)(int nblocks, const swifft_key_t * key, const int16_t * coeffs,
+	const BitSequence * input, BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Computes a linear combination of the results of SWIFFT operations with a given key for multiple blocks.
+//! The result is the same as SWIFFT_LinearCombination of the results of SWIFFT_ComputeMultipleSignedKeyed, but faster.
+//!
+//! \param[in] nblocks the number of blocks to combine.
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] coeffs the coefficients of the blocks.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_ComputeLinearCombinationSignedKeyed)(int nblocks, const swifft_key_t * key, const int16_t * coeffs,
+	const BitSequence * input, const BitSequence * sign, BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Updates the result of a SWIFFT operation for a change of some input bits.
+//! The result is the same as computing SWIFFT_Compute of the new input, in time proportional to the number of positions.
+//!
+//! \param[in,out] output the hash value of SWIFFT of the old input, of size 128 bytes (1024 bit), to update to that of the new input.
+//! \param[in] npositions the number of positions of input bits to update.
+//! \param[in] positions the distinct positions of the input bits that may have changed, each in {0,..,2047} for bit p&7 of byte p>>3.
+//! \param[in] oldInput the old input of 256 bytes (2048 bit).
+//! \param[in] newInput the new input of 256 bytes (2048 bit).
+void LIBSWIFFT_API(SWIFFT_UpdateBits)(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
+	int npositions, const int * positions, const BitSequence * oldInput, const BitSequence * newInput);
+
+//! \brief Updates the result of a SWIFFT operation for a change of some input bits or their sign bits.
+//! The result is the same as computing SWIFFT_ComputeSigned of the new input, in time proportional to the number of positions.
+//!
+//! \param[in,out] output the hash value of SWIFFT of the old input, of size 128 bytes (1024 bit), to update to that of the new input.
+//! \param[in] npositions the number of positions of input bits to update.
+//! \param[in] positions the distinct positions of the input bits that may have changed, each in {0,..,2047} for bit p&7 of byte p>>3.
+//! \param[in] oldInput the old input of 256 bytes (2048 bit).
+//! \param[in] oldSign the sign bits corresponding to the old input of 256 bytes (2048 bit).
+//! \param[in] newInput the new input of 256 bytes (2048 bit).
+//! \param[in] newSign the sign bits corresponding to the new input of 256 bytes (2048 bit).
+void LIBSWIFFT_API(SWIFFT_UpdateBitsSigned)(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
+	int npositions, const int * positions, const BitSequence * oldInput, const BitSequence * oldSign,
+	const BitSequence * newInput, const BitSequence * newSign);
+
+//! \brief Updates the results of multiple SWIFFT operations for a change of some input bits.
+//! The result is the same as computing SWIFFT_ComputeMultiple of the new inputs, in time proportional to the number of positions.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the blocks of hash values of SWIFFT of the old inputs, each of size 128 bytes (1024 bit), to update to those of the new inputs.
+//! \param[in] npositions the number of positions of input bits to update in each block.
+//! \param[in] positions the distinct positions of the input bits that may have changed in each block, each in {0,..,2047} for bit p&7 of byte p>>3.
+//! \param[in] oldInput the blocks of old input, each of 256 bytes (2048 bit).
+//! \param[in] newInput the blocks of new input, each of 256 bytes (2048 bit).
+void LIBSWIFFT_API(SWIFFT_UpdateBitsMultiple)(int nblocks, BitSequence * output,
+	int npositions, const int * positions, const BitSequence * oldInput, const BitSequence * newInput);
+
+//! \brief Updates the results of multiple SWIFFT operations for a change of some input bits or their sign bits.
+//! The result is the same as computing SWIFFT_ComputeMultipleSigned of the new inputs, in time proportional to the number of positions.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the blocks of hash values of SWIFFT of the old inputs, each of size 128 bytes (1024 bit), to update to those of the new inputs.
+//! \param[in] npositions the number of positions of input bits to update in each block.
+//! \param[in] positions the distinct positions of the input bits that may have changed in each block, each in {0,..,2047} for bit p&7 of byte p>>3.
+//! \param[in] oldInput the blocks of old input, each of 256 bytes (2048 bit).
+//! \param[in] oldSign the blocks of sign bits corresponding to blocks of old input of 256 bytes (2048 bit).
+//! \param[in] newInput the blocks of new input, each of 256 bytes (2048 bit).
+//! \param[in] newSign the blocks of sign bits corresponding to blocks of new input of 256 bytes (2048 bit).
+void LIBSWIFFT_API(SWIFFT_UpdateBitsMultipleSigned)(int nblocks, BitSequence * output,
+	int npositions, const int * positions, const BitSequence * oldInput, const BitSequence * oldSign,
+	const BitSequence * newInput, const BitSequence * newSign);
+
+//! \brief Computes the result of a SWIFFT operation on a sparse input, given by the positions of its nonzero bits.
+//! The result is the same as for SWIFFT_Compute, in time proportional to the number of nonzero bits when they are few.
+//!
+//! \param[in] count the number of nonzero input bits.
+//! \param[in] indices the distinct positions of the nonzero input bits, each in {0,..,2047} for bit p&7 of byte p>>3.
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_ComputeSparse)(int count, const int * indices, BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Computes the result of a SWIFFT operation on a sparse input, given by the positions and signs of its nonzero bits.
+//! The result is the same as for SWIFFT_ComputeSigned, in time proportional to the number of nonzero bits when they are few.
+//!
+//! \param[in] count the number of nonzero input bits.
+//! \param[in] indices the distinct positions of the nonzero input bits, each in {0,..,2047} for bit p&7 of byte p>>3.
+//! \param[in] sign the signs of the nonzero input bits, each 1 for negative or 0 for positive.
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_ComputeSparseSigned)(int count, const int * indices, const BitSequence * sign,
+	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Computes the results of multiple SWIFFT operations on sparse inputs, given by the positions of their nonzero bits.
+//! The result is the same as for SWIFFT_ComputeMultiple, in time proportional to the number of nonzero bits when they are few.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] offsets the nblocks+1 offsets in indices where the nonzero input bits of each block start, followed by their total number.
+//! \param[in] indices the distinct positions of the nonzero input bits of each block, each in {0,..,2047} for bit p&7 of byte p>>3.
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_ComputeSparseMultiple)(int nblocks, const int * offsets, const int * indices,
+	BitSequence * output);
+
+//! \brief Computes the results of multiple SWIFFT operations on sparse inputs, given by the positions and signs of their nonzero bits.
+//! The result is the same as for SWIFFT_ComputeMultipleSigned, in time proportional to the number of nonzero bits when they are few.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] offsets the nblocks+1 offsets in indices where the nonzero input bits of each block start, followed by their total number.
+//! \param[in] indices the distinct positions of the nonzero input bits of each block, each in {0,..,2047} for bit p&7 of byte p>>3.
+//! \param[in] sign the signs of the nonzero input bits, each 1 for negative or 0 for positive.
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void LIBSWIFFT_API(SWIFFT_ComputeSparseMultipleSigned)(int nblocks, const int * offsets, const int * indices,
+	const BitSequence * sign, BitSequence * output);
@@ -10,7 +10,7 @@
 
 #undef SWIFFT_ISET_NAME
 #ifndef SWIFFT_ISET
-        #error "SWIFFT_ISET() must be defined as AVX, AVX2, or AVX512"
+        #error "SWIFFT_ISET() must be defined as AVX, AVX2, AVX512, or AVX512BW"
 #endif
 #define SWIFFT_ISET_NAME(name) LIBSWIFFT_CONCAT(name,SWIFFT_ISET()) ///< Adds a suffix SWIFFT_ISET, a macro which must be defined prior to including
 
@@ -89,6 +89,38 @@ void SWIFFT_ISET_NAME(SWIFFT_Sub_)(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
 void SWIFFT_ISET_NAME(SWIFFT_Mul_)(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
         const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE]);
 
+//! \brief Adds the product of two SWIFFT hash values to another, element-wise.
+//!
+//! \param[in,out] output the hash value of SWIFFT to modify.
+//! \param[in] operand1 the first hash value to multiply.
+//! \param[in] operand2 the second hash value to multiply.
+void SWIFFT_ISET_NAME(SWIFFT_MulAdd_)(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
+        const BitSequence operand1[SWIFFT_OUTPUT_BLOCK_SIZE], const BitSequence operand2[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Subtracts the product of two SWIFFT hash values from another, element-wise.
+//!
+//! \param[in,out] output the hash value of SWIFFT to modify.
+//! \param[in] operand1 the first hash value to multiply.
+//! \param[in] operand2 the second hash value to multiply.
+void SWIFFT_ISET_NAME(SWIFFT_MulSub_)(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
+        const BitSequence operand1[SWIFFT_OUTPUT_BLOCK_SIZE], const BitSequence operand2[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Adds the product of a SWIFFT hash value and a constant value to another, element-wise.
+//!
+//! \param[in,out] output the hash value of SWIFFT to modify.
+//! \param[in] operand the hash value to multiply.
+//! \param[in] multiplier the constant value to multiply by.
+void SWIFFT_ISET_NAME(SWIFFT_ConstMulAdd_)(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
+        const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE], const int16_t multiplier);
+
+//! \brief Subtracts the product of a SWIFFT hash value and a constant value from another, element-wise.
+//!
+//! \param[in,out] output the hash value of SWIFFT to modify.
+//! \param[in] operand the hash value to multiply.
+//! \param[in] multiplier the constant value to multiply by.
+void SWIFFT_ISET_NAME(SWIFFT_ConstMulSub_)(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
+        const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE], const int16_t multiplier);
+
 //! \brief Computes the result of a SWIFFT operation.
 //! The result is composable with other hash values.
 //!
@@ -126,6 +158,14 @@ void SWIFFT_ISET_NAME(SWIFFT_fftMultiple_)(int nblocks, const BitSequence * LIBS
 void SWIFFT_ISET_NAME(SWIFFT_fftsumMultiple_)(int nblocks, const int16_t * LIBSWIFFT_RESTRICT ikey,
         const int16_t * LIBSWIFFT_RESTRICT ifftout, int m, int16_t * LIBSWIFFT_RESTRICT iout);
 
+//! \brief Compacts a hash value of SWIFFT.
+//! The result is not composable with other compacted hash values.
+//!
+//! \param[in] output the hash value of SWIFFT, of size 128 bytes (1024 bit).
+//! \param[out] compact the compacted hash value of SWIFFT, of size 64 bytes (512 bit).
+void SWIFFT_ISET_NAME(SWIFFT_Compact_)(const BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
+        BitSequence compact[SWIFFT_COMPACT_BLOCK_SIZE]);
+
 //! \brief Compacts a hash value of SWIFFT for multiple blocks.
 //! The result is not composable with other compacted hash values.
 //!
@@ -134,6 +174,18 @@ void SWIFFT_ISET_NAME(SWIFFT_fftsumMultiple_)(int nblocks, const int16_t * LIBSW
 //! \param[out] compact the compacted hash value of SWIFFT, of size 64 bytes (512 bit) per block.
 void SWIFFT_ISET_NAME(SWIFFT_CompactMultiple_)(int nblocks, const BitSequence * output,
         BitSequence * compact);
+void SWIFFT_ISET_NAME(SWIFFT_CompactWithCarry_)(const BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
+        BitSequence compact[SWIFFT_COMPACT_BLOCK_SIZE], BitSequence carry[SWIFFT_COMPACT_CARRY_SIZE]);
+void SWIFFT_ISET_NAME(SWIFFT_CompactWithCarryMultiple_)(int nblocks, const BitSequence * output,
+        BitSequence * compact, BitSequence * carry);
+void SWIFFT_ISET_NAME(SWIFFT_Decompact_)(const BitSequence compact[SWIFFT_COMPACT_BLOCK_SIZE],
+        const BitSequence carry[SWIFFT_COMPACT_CARRY_SIZE], BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+void SWIFFT_ISET_NAME(SWIFFT_DecompactMultiple_)(int nblocks, const BitSequence * compact,
+        const BitSequence * carry, BitSequence * output);
+void SWIFFT_ISET_NAME(SWIFFT_CompactEqualMultiple_)(int nblocks, const BitSequence * compact1, const BitSequence * compact2,
+        BitSequence * equal);
+int SWIFFT_ISET_NAME(SWIFFT_FindCompactMatch_)(int nblocks, const BitSequence * haystack,
+        const BitSequence needle[SWIFFT_COMPACT_BLOCK_SIZE]);
 
 //! \brief Sets a constant value at each SWIFFT hash value element for multiple blocks.
 //!
@@ -199,6 +251,190 @@ void SWIFFT_ISET_NAME(SWIFFT_SubMultiple_)(int nblocks, BitSequence * output,
 void SWIFFT_ISET_NAME(SWIFFT_MulMultiple_)(int nblocks, BitSequence * output,
         const BitSequence * operand);
 
+//! \brief Adds the product of two SWIFFT hash values to another, element-wise, for multiple blocks.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the hash value of SWIFFT to modify.
+//! \param[in] operand1 the first hash value to multiply.
+//! \param[in] operand2 the second hash value to multiply.
+void SWIFFT_ISET_NAME(SWIFFT_MulAddMultiple_)(int nblocks, BitSequence * output,
+        const BitSequence * operand1, const BitSequence * operand2);
+
+//! \brief Subtracts the product of two SWIFFT hash values from another, element-wise, for multiple blocks.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the hash value of SWIFFT to modify.
+//! \param[in] operand1 the first hash value to multiply.
+//! \param[in] operand2 the second hash value to multiply.
+void SWIFFT_ISET_NAME(SWIFFT_MulSubMultiple_)(int nblocks, BitSequence * output,
+        const BitSequence * operand1, const BitSequence * operand2);
+
+//! \brief Adds the product of a SWIFFT hash value and a constant value to another, element-wise, for multiple blocks.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the hash value of SWIFFT to modify, per block.
+//! \param[in] operand the hash value to multiply, per block.
+//! \param[in] multiplier the constant value to multiply by, per block.
+void SWIFFT_ISET_NAME(SWIFFT_ConstMulAddMultiple_)(int nblocks, BitSequence * output,
+        const BitSequence * operand, const int16_t * multiplier);
+
+//! \brief Subtracts the product of a SWIFFT hash value and a constant value from another, element-wise, for multiple blocks.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the hash value of SWIFFT to modify, per block.
+//! \param[in] operand the hash value to multiply, per block.
+//! \param[in] multiplier the constant value to multiply by, per block.
+void SWIFFT_ISET_NAME(SWIFFT_ConstMulSubMultiple_)(int nblocks, BitSequence * output,
+        const BitSequence * operand, const int16_t * multiplier);
+
+//! \brief Sets a SWIFFT hash value to another, element-wise, for multiple blocks with the same operand.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[out] output the hash value of SWIFFT to modify, per block.
+//! \param[in] operand the hash value to set to, for all blocks.
+void SWIFFT_ISET_NAME(SWIFFT_SetBroadcast_)(int nblocks, BitSequence * output,
+        const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Adds a SWIFFT hash value to another, element-wise, for multiple blocks with the same operand.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the hash value of SWIFFT to modify, per block.
+//! \param[in] operand the hash value to add, for all blocks.
+void SWIFFT_ISET_NAME(SWIFFT_AddBroadcast_)(int nblocks, BitSequence * output,
+        const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Subtracts a SWIFFT hash value from another, element-wise, for multiple blocks with the same operand.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the hash value of SWIFFT to modify, per block.
+//! \param[in] operand the hash value to subtract, for all blocks.
+void SWIFFT_ISET_NAME(SWIFFT_SubBroadcast_)(int nblocks, BitSequence * output,
+        const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Multiplies a SWIFFT hash value by another, element-wise, for multiple blocks with the same operand.
+//! The operand is centered once for all blocks.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the hash value of SWIFFT to modify, per block.
+//! \param[in] operand the hash value to multiply by, for all blocks.
+void SWIFFT_ISET_NAME(SWIFFT_MulBroadcast_)(int nblocks, BitSequence * output,
+        const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Sets SWIFFT hash values to the products of one SWIFFT hash value by constant values.
+//! The operand is centered once for all blocks, and each block of output is written without being read.
+//!
+//! \param[in] nblocks the number of blocks to operate on, one per constant value.
+//! \param[out] output the hash value of SWIFFT to set, per block.
+//! \param[in] operand the hash value to multiply, for all blocks.
+//! \param[in] multiplier the constant value to multiply by, per block.
+void SWIFFT_ISET_NAME(SWIFFT_ConstMulOuter_)(int nblocks, BitSequence * output,
+        const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE], const int16_t * multiplier);
+
+//! \brief Computes a linear combination of SWIFFT hash values, element-wise.
+//! The sum of products is accumulated into 32-bit elements and reduced mod 257 once.
+//!
+//! \param[in] n the number of terms.
+//! \param[in] coeffs the coefficients of the terms.
+//! \param[in] operand the hash value of each term, per block, with elements in the range {0,..,SWIFFT_P-1},
+//! as output by LibSWIFFT; other elements must first be canonicalized using SWIFFT_Canonicalize.
+//! \param[out] output the hash value of SWIFFT to set to the linear combination.
+void SWIFFT_ISET_NAME(SWIFFT_LinearCombination_)(int n, const int16_t * coeffs,
+        const BitSequence * operand, BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Computes linear combinations of SWIFFT hash values, element-wise, for multiple blocks.
+//! The linear combination for each output block has its own n coefficients and n operand blocks.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] n the number of terms per block.
+//! \param[in] coeffs the coefficients of the terms, n per block.
+//! \param[in] operand the hash value of each term, n blocks per block, with elements in the range {0,..,SWIFFT_P-1},
+//! as output by LibSWIFFT; other elements must first be canonicalized using SWIFFT_CanonicalizeMultiple.
+//! \param[out] output the hash value of SWIFFT to set to the linear combination, per block.
+void SWIFFT_ISET_NAME(SWIFFT_LinearCombinationMultiple_)(int nblocks, int n, const int16_t * coeffs,
+        const BitSequence * operand, BitSequence * output);
+
+//! \brief Multiplies a matrix by a vector of SWIFFT hash values, over Z_257.
+//! Computes output[i] = sum_j matrix[i*n+j]*operand[j], element-wise, for i in {0,..,k-1}.
+//!
+//! \param[in] k the number of rows of the matrix.
+//! \param[in] n the number of columns of the matrix.
+//! \param[in] matrix the matrix of k*n coefficients, in row-major order.
+//! \param[in] operand the vector of n hash values.
+//! \param[out] output the resulting vector of k hash values.
+void SWIFFT_ISET_NAME(SWIFFT_MatMulOutputs_)(int k, int n, const int16_t * matrix,
+        const BitSequence * operand, BitSequence * output);
+void SWIFFT_ISET_NAME(SWIFFT_ToCoefficients_)(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+void SWIFFT_ISET_NAME(SWIFFT_FromCoefficients_)(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+void SWIFFT_ISET_NAME(SWIFFT_ToCoefficientsMultiple_)(int nblocks, BitSequence * output);
+void SWIFFT_ISET_NAME(SWIFFT_FromCoefficientsMultiple_)(int nblocks, BitSequence * output);
+void SWIFFT_ISET_NAME(SWIFFT_Canonicalize_)(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+void SWIFFT_ISET_NAME(SWIFFT_CanonicalizeMultiple_)(int nblocks, BitSequence * output);
+int SWIFFT_ISET_NAME(SWIFFT_Equal_)(const BitSequence operand1[SWIFFT_OUTPUT_BLOCK_SIZE], const BitSequence operand2[SWIFFT_OUTPUT_BLOCK_SIZE]);
+void SWIFFT_ISET_NAME(SWIFFT_EqualMultiple_)(int nblocks, const BitSequence * operand1, const BitSequence * operand2,
+        BitSequence * equal);
+int SWIFFT_ISET_NAME(SWIFFT_FindMatch_)(int nblocks, const BitSequence * haystack,
+        const BitSequence needle[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Sums SWIFFT hash values of multiple blocks, element-wise.
+//! Partial sums are accumulated with lazy reduction, in parallel when built with OpenMP.
+//!
+//! \param[in] nblocks the number of blocks to sum.
+//! \param[in] operand the hash value to sum, per block, with elements in the range {0,..,SWIFFT_P-1}.
+//! \param[out] output the hash value of SWIFFT to set to the sum.
+void SWIFFT_ISET_NAME(SWIFFT_SumMultiple_)(int nblocks, const BitSequence * operand,
+        BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Multiplies SWIFFT hash values of multiple blocks, element-wise.
+//! Partial products are computed in parallel when built with OpenMP.
+//!
+//! \param[in] nblocks the number of blocks to multiply.
+//! \param[in] operand the hash value to multiply, per block, with elements in the range {0,..,SWIFFT_P-1}.
+//! \param[out] output the hash value of SWIFFT to set to the product.
+void SWIFFT_ISET_NAME(SWIFFT_ProductMultiple_)(int nblocks, const BitSequence * operand,
+        BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Initializes a SWIFFT accumulator to a zero sum.
+//!
+//! \param[out] accumulator the SWIFFT accumulator to initialize.
+void SWIFFT_ISET_NAME(SWIFFT_AccumulatorInit_)(swifft_accumulator_t * accumulator);
+
+//! \brief Adds a SWIFFT hash value to a SWIFFT accumulator, element-wise, without reducing it.
+//!
+//! \param[in,out] accumulator the SWIFFT accumulator to modify.
+//! \param[in] operand the hash value to add, with elements in the range {0,..,SWIFFT_P-1}.
+void SWIFFT_ISET_NAME(SWIFFT_AccumulatorAdd_)(swifft_accumulator_t * accumulator,
+        const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Subtracts a SWIFFT hash value from a SWIFFT accumulator, element-wise, without reducing it.
+//!
+//! \param[in,out] accumulator the SWIFFT accumulator to modify.
+//! \param[in] operand the hash value to subtract, with elements in the range {0,..,SWIFFT_P-1}.
+void SWIFFT_ISET_NAME(SWIFFT_AccumulatorSub_)(swifft_accumulator_t * accumulator,
+        const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Adds SWIFFT hash values of multiple blocks to a SWIFFT accumulator, element-wise, without reducing it.
+//!
+//! \param[in,out] accumulator the SWIFFT accumulator to modify.
+//! \param[in] nblocks the number of blocks to add.
+//! \param[in] operand the hash value to add, per block, with elements in the range {0,..,SWIFFT_P-1}.
+void SWIFFT_ISET_NAME(SWIFFT_AccumulatorAddMultiple_)(swifft_accumulator_t * accumulator, int nblocks,
+        const BitSequence * operand);
+
+//! \brief Subtracts SWIFFT hash values of multiple blocks from a SWIFFT accumulator, element-wise, without reducing it.
+//!
+//! \param[in,out] accumulator the SWIFFT accumulator to modify.
+//! \param[in] nblocks the number of blocks to subtract.
+//! \param[in] operand the hash value to subtract, per block, with elements in the range {0,..,SWIFFT_P-1}.
+void SWIFFT_ISET_NAME(SWIFFT_AccumulatorSubMultiple_)(swifft_accumulator_t * accumulator, int nblocks,
+        const BitSequence * operand);
+
+//! \brief Gets the sum of a SWIFFT accumulator as a SWIFFT hash value, reduced mod 257.
+//!
+//! \param[in] accumulator the SWIFFT accumulator.
+//! \param[out] output the hash value of SWIFFT to set to the sum.
+void SWIFFT_ISET_NAME(SWIFFT_AccumulatorGet_)(const swifft_accumulator_t * accumulator,
+        BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
 //! \brief Computes the result of multiple SWIFFT operations.
 //! The result is composable with other hash values.
 //!
@@ -216,5 +452,211 @@ void SWIFFT_ISET_NAME(SWIFFT_ComputeMultiple_)(int nblocks, const BitSequence *
 //! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
 void SWIFFT_ISET_NAME(SWIFFT_ComputeMultipleSigned_)(int nblocks, const BitSequence * input,
         const BitSequence * sign, BitSequence * output);
+void SWIFFT_ISET_NAME(SWIFFT_ComputeKeyed_)(const swifft_key_t * key, const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE],
+        BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+void SWIFFT_ISET_NAME(SWIFFT_ComputeSignedKeyed_)(const swifft_key_t * key, const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE],
+        const BitSequence sign[SWIFFT_INPUT_BLOCK_SIZE], BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+void SWIFFT_ISET_NAME(SWIFFT_ComputeMultipleKeyed_)(int nblocks, const swifft_key_t * key, const BitSequence * input,
+        BitSequence * output);
+void SWIFFT_ISET_NAME(SWIFFT_ComputeMultipleSignedKeyed_)(int nblocks, const swifft_key_t * key, const BitSequence * input,
+        const BitSequence * sign, BitSequence * output);
+void SWIFFT_ISET_NAME(SWIFFT_ComputeMultiKey_)(int nkeys, const swifft_key_t * keys, const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE],
+        BitSequence * output);
+void SWIFFT_ISET_NAME(SWIFFT_ComputeSignedMultiKey_)(int nkeys, const swifft_key_t * keys, const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE],
+        const BitSequence sign[SWIFFT_INPUT_BLOCK_SIZE], BitSequence * output);
+void SWIFFT_ISET_NAME(SWIFFT_ComputeMultipleMultiKey_)(int nblocks, int nkeys, const swifft_key_t * keys, const BitSequence * input,
+        BitSequence * output);
+void SWIFFT_ISET_NAME(SWIFFT_ComputeMultipleSignedMultiKey_)(int nblocks, int nkeys, const swifft_key_t * keys, const BitSequence * input,
+        const BitSequence * sign, BitSequence * output);
+void SWIFFT_ISET_NAME(SWIFFT_DeriveKey_)(const BitSequence seed[SWIFFT_KEY_SEED_SIZE], swifft_key_t * key);
+
+//! \brief Computes the result of a SWIFFT operation on a short input.
+//! The result is the same as for the input padded with zeros to 256 bytes.
+//!
+//! \param[in] input the input of 128 bytes (1024 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_Compute128_)(const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE_128],
+        BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Computes the result of a SWIFFT operation on a short input.
+//! The result is the same as for the input and sign bits padded with zeros to 256 bytes.
+//!
+//! \param[in] input the input of 128 bytes (1024 bit).
+//! \param[in] sign the sign bits corresponding to the input of 128 bytes (1024 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeSigned128_)(const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE_128],
+        const BitSequence sign[SWIFFT_INPUT_BLOCK_SIZE_128],
+        BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Computes the result of multiple SWIFFT operations on short inputs.
+//! The result is the same as for the inputs padded with zeros to 256 bytes.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] input the blocks of input, each of 128 bytes (1024 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeMultiple128_)(int nblocks, const BitSequence * input, BitSequence * output);
+
+//! \brief Computes the result of multiple SWIFFT operations on short inputs.
+//! The result is the same as for the inputs and sign bits padded with zeros to 256 bytes.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] input the blocks of input, each of 128 bytes (1024 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 128 bytes (1024 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeMultipleSigned128_)(int nblocks, const BitSequence * input,
+        const BitSequence * sign, BitSequence * output);
+
+//! \brief Computes the result of a SWIFFT operation on a short input.
+//! The result is the same as for the input padded with zeros to 256 bytes.
+//!
+//! \param[in] input the input of 64 bytes (512 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_Compute64_)(const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE_64],
+        BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Computes the result of a SWIFFT operation on a short input.
+//! The result is the same as for the input and sign bits padded with zeros to 256 bytes.
+//!
+//! \param[in] input the input of 64 bytes (512 bit).
+//! \param[in] sign the sign bits corresponding to the input of 64 bytes (512 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeSigned64_)(const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE_64],
+        const BitSequence sign[SWIFFT_INPUT_BLOCK_SIZE_64],
+        BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Computes the result of multiple SWIFFT operations on short inputs.
+//! The result is the same as for the inputs padded with zeros to 256 bytes.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] input the blocks of input, each of 64 bytes (512 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeMultiple64_)(int nblocks, const BitSequence * input, BitSequence * output);
+
+//! \brief Computes the result of multiple SWIFFT operations on short inputs.
+//! The result is the same as for the inputs and sign bits padded with zeros to 256 bytes.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] input the blocks of input, each of 64 bytes (512 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 64 bytes (512 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeMultipleSigned64_)(int nblocks, const BitSequence * input,
+        const BitSequence * sign, BitSequence * output);
+void SWIFFT_ISET_NAME(SWIFFT_Compute128Keyed_)(const swifft_key_t * key, const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE_128],
+        BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+void SWIFFT_ISET_NAME(SWIFFT_ComputeSigned128Keyed_)(const swifft_key_t * key, const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE_128],
+        const BitSequence sign[SWIFFT_INPUT_BLOCK_SIZE_128], BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+void SWIFFT_ISET_NAME(SWIFFT_ComputeMultiple128Keyed_)(int nblocks, const swifft_key_t * key, const BitSequence * input,
+        BitSequence * output);
+void SWIFFT_ISET_NAME(SWIFFT_ComputeMultipleSigned128Keyed_)(int nblocks, const swifft_key_t * key, const BitSequence * input,
+        const BitSequence * sign, BitSequence * output);
+void SWIFFT_ISET_NAME(SWIFFT_Compute64Keyed_)(const swifft_key_t * key, const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE_64],
+        BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+void SWIFFT_ISET_NAME(SWIFFT_ComputeSigned64Keyed_)(const swifft_key_t * key, const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE_64],
+        const BitSequence sign[SWIFFT_INPUT_BLOCK_SIZE_64], BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+void SWIFFT_ISET_NAME(SWIFFT_ComputeMultiple64Keyed_)(int nblocks, const swifft_key_t * key, const BitSequence * input,
+        BitSequence * output);
+void SWIFFT_ISET_NAME(SWIFFT_ComputeMultipleSigned64Keyed_)(int nblocks, const swifft_key_t * key, const BitSequence * input,
+        const BitSequence * sign, BitSequence * output);
+
+//! \brief Computes the sum of the results of SWIFFT operations for multiple blocks.
+//! The result is the same as summing the results of SWIFFT_ComputeMultiple, but faster.
+//!
+//! \param[in] nblocks the number of blocks to sum.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeSum_)(int nblocks, const BitSequence * input,
+        BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Computes the sum of the results of SWIFFT operations for multiple blocks.
+//! The result is the same as summing the results of SWIFFT_ComputeMultipleSigned, but faster.
+//!
+//! \param[in] nblocks the number of blocks to sum.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeSumSigned_)(int nblocks, const BitSequence * input,
+        const BitSequence * sign, BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Computes a linear combination of the results of SWIFFT operations for multiple blocks.
+//! The result is the same as SWIFFT_LinearCombination of the results of SWIFFT_ComputeMultiple, but faster.
+//!
+//! \param[in] nblocks the number of blocks to combine.
+//! \param[in] coeffs the coefficients of the blocks.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeLinearCombination_)(int nblocks, const int16_t * coeffs,
+        const BitSequence * input, BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Computes a linear combination of the results of SWIFFT operations for multiple blocks.
+//! The result is the same as SWIFFT_LinearCombination of the results of SWIFFT_ComputeMultipleSigned, but faster.
+//!
+//! \param[in] nblocks the number of blocks to combine.
+//! \param[in] coeffs the coefficients of the blocks.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeLinearCombinationSigned_)(int nblocks, const int16_t * coeffs,
+        const BitSequence * input, const BitSequence * sign, BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Computes the sum of the results of SWIFFT operations with a given key for multiple blocks.
+//! The result is the same as summing the results of SWIFFT_ComputeMultipleKeyed, but faster.
+//!
+//! \param[in] nblocks the number of blocks to sum.
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeSumKeyed_)(int nblocks, const swifft_key_t * key, const BitSequence * input,
+        BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Computes the sum of the results of SWIFFT operations with a given key for multiple blocks.
+//! The result is the same as summing the results of SWIFFT_ComputeMultipleSignedKeyed, but faster.
+//!
+//! \param[in] nblocks the number of blocks to sum.
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeSumSignedKeyed_)(int nblocks, const swifft_key_t * key, const BitSequence * input,
+        const BitSequence * sign, BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Computes a linear combination of the results of SWIFFT operations with a given key for multiple blocks.
+//! The result is the same as SWIFFT_LinearCombination of the results of SWIFFT_ComputeMultipleKeyed, but faster.
+//!
+//! \param[in] nblocks the number of blocks to combine.
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] coeffs the coefficients of the blocks.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeLinearCombinationKeyed_)(int nblocks, const swifft_key_t * key, const int16_t * coeffs,
+        const BitSequence * input, BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+
+//! \brief Computes a linear combination of the results of SWIFFT operations with a given key for multiple blocks.
+//! The result is the same as SWIFFT_LinearCombination of the results of SWIFFT_ComputeMultipleSignedKeyed, but faster.
+//!
+//! \param[in] nblocks the number of blocks to combine.
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] coeffs the coefficients of the blocks.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeLinearCombinationSignedKeyed_)(int nblocks, const swifft_key_t * key, const int16_t * coeffs,
+        const BitSequence * input, const BitSequence * sign, BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+void SWIFFT_ISET_NAME(SWIFFT_UpdateBits_)(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
+        int npositions, const int * positions, const BitSequence * oldInput, const BitSequence * newInput);
+void SWIFFT_ISET_NAME(SWIFFT_UpdateBitsSigned_)(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
+        int npositions, const int * positions, const BitSequence * oldInput, const BitSequence * oldSign,
+        const BitSequence * newInput, const BitSequence * newSign);
+void SWIFFT_ISET_NAME(SWIFFT_UpdateBitsMultiple_)(int nblocks, BitSequence * output,
+        int npositions, const int * positions, const BitSequence * oldInput, const BitSequence * newInput);
+void SWIFFT_ISET_NAME(SWIFFT_UpdateBitsMultipleSigned_)(int nblocks, BitSequence * output,
+        int npositions, const int * positions, const BitSequence * oldInput, const BitSequence * oldSign,
+        const BitSequence * newInput, const BitSequence * newSign);
+void SWIFFT_ISET_NAME(SWIFFT_ComputeSparse_)(int count, const int * indices, BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+void SWIFFT_ISET_NAME(SWIFFT_ComputeSparseSigned_)(int count, const int * indices, const BitSequence * sign,
+        BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE]);
+void SWIFFT_ISET_NAME(SWIFFT_ComputeSparseMultiple_)(int nblocks, const int * offsets, const int * indices,
+        BitSequence * output);
+void SWIFFT_ISET_NAME(SWIFFT_ComputeSparseMultipleSigned_)(int nblocks, const int * offsets, const int * indices,
+        const BitSequence * sign, BitSequence * output);
 
 LIBSWIFFT_END_EXTERN_C
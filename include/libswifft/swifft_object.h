@@ -44,32 +44,32 @@ typedef struct {
 #undef SWIFFT_ISET
 #include "libswifft/swifft_object_iset.inl"
 
-#if defined(__AVX__)
-        #include "libswifft/swifft_avx.h"
-        #undef SWIFFT_ISET
-        #define SWIFFT_ISET() AVX
-        #include "libswifft/swifft_object_iset.inl"
-#else
-        #pragma message "LibSWIFFT API for AVX is disabled"
-#endif
-
-#if defined(__AVX2__)
-        #include "libswifft/swifft_avx2.h"
-        #undef SWIFFT_ISET
-        #define SWIFFT_ISET() AVX2
-        #include "libswifft/swifft_object_iset.inl"
-#else
-        #pragma message "LibSWIFFT API for AVX2 is disabled"
-#endif
-
-#if defined(__AVX512F__)
-        #include "libswifft/swifft_avx512.h"
-        #undef SWIFFT_ISET
-        #define SWIFFT_ISET() AVX512
-        #include "libswifft/swifft_object_iset.inl"
-#else
-        #pragma message "LibSWIFFT API for AVX512 is disabled"
-#endif
+#include "libswifft/swifft_avx.h"
+#undef SWIFFT_ISET
+#define SWIFFT_ISET() AVX
+#include "libswifft/swifft_object_iset.inl"
+
+#include "libswifft/swifft_avx2.h"
+#undef SWIFFT_ISET
+#define SWIFFT_ISET() AVX2
+#include "libswifft/swifft_object_iset.inl"
+
+#include "libswifft/swifft_avx512.h"
+#undef SWIFFT_ISET
+#define SWIFFT_ISET() AVX512
+#include "libswifft/swifft_object_iset.inl"
+
+#include "libswifft/swifft_avx512bw.h"
+#undef SWIFFT_ISET
+#define SWIFFT_ISET() AVX512BW
+#include "libswifft/swifft_object_iset.inl"
+
+//! \brief Initializes a SWIFFT object with the implementation for a given instruction-set.
+//!
+//! \param[out] swifft the SWIFFT object to initialize.
+//! \param[in] iset the instruction-set whose implementation to use.
+//! \returns 0 on success, or -1 if the instruction-set is not supported on the running platform.
+int SWIFFT_InitIsetObject(swifft_object_t *swifft, swifft_iset_t iset);
 
 LIBSWIFFT_END_EXTERN_C
 
@@ -21,6 +21,11 @@
 
 LIBSWIFFT_BEGIN_EXTERN_C
 
+//! \brief Initializes a SWIFFT object.
+//! Without a suffix, the implementation for the instruction-set currently selected by the
+//! main API is used (see SWIFFT_GetIset), and if none is supported the object is left without functions.
+//!
+//! \param[out] swifft the SWIFFT object to initialize.
 void SWIFFT_ISET_NAME(SWIFFT_InitObject)(swifft_object_t *swifft);
 
 LIBSWIFFT_END_EXTERN_C
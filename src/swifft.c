@@ -6,16 +6,17 @@
 /*! \file src/swifft.c
  * \brief LibSWIFFT public C implementation
  *
- * Implementation using the best instruction set available at build time.
+ * Implementation dispatching to the best instruction set supported by the running platform.
  */
 
+#include <stdlib.h> // for posix_memalign
+#include <string.h> // for memcpy
+#ifdef __linux__
+	#include <sys/mman.h> // for madvise
+#endif
 #include "libswifft/swifft.h"
-#include "libswifft/swifft_avx.h"
-#include "libswifft/swifft_avx2.h"
-#include "libswifft/swifft_avx512.h"
+#include "libswifft/swifft_object.h"
 
-#undef SWIFFT_ISET
-#define SWIFFT_ISET() SWIFFT_INSTRUCTION_SET
 #include "swifft_ops.inl"
 
 
@@ -23,49 +24,206 @@ LIBSWIFFT_BEGIN_EXTERN_C
 
 SWIFFT_ALIGN const BitSequence SWIFFT_sign0[SWIFFT_INPUT_BLOCK_SIZE] = {0};
 
-void SWIFFT_fft(const BitSequence * LIBSWIFFT_RESTRICT input, const BitSequence * LIBSWIFFT_RESTRICT sign, int m, int16_t * LIBSWIFFT_RESTRICT fftout)
+//! Number of instruction-set values, including SWIFFT_ISET_NONE
+#define SWIFFT_ISET_COUNT (SWIFFT_ISET_AVX512BW + 1)
+
+//! Size of a huge page, used for aligning memory requested to be on huge pages
+#define SWIFFT_HUGE_PAGE_SIZE ((size_t)2 << 20)
+
+//! \brief SWIFFT objects, per instruction-set, for dispatching the main API.
+static swifft_object_t SWIFFT_isetObjects[SWIFFT_ISET_COUNT];
+//! \brief The instruction-set selected for the main API, accessed atomically.
+static swifft_iset_t SWIFFT_selectedIset = SWIFFT_ISET_NONE;
+//! \brief State of initialization of the dispatching: 0 - not started, 1 - in progress, 2 - done.
+static int SWIFFT_dispatchState = 0;
+
+//! \brief Initializes the dispatching of the main API, once.
+//! This runs when the library is loaded, or earlier if the main API is used by another constructor.
+static void SWIFFT_InitDispatch(void) __attribute__((constructor));
+
+static void SWIFFT_InitDispatch(void)
 {
-	SWIFFT_ISET_NAME(SWIFFT_fft_)(input, sign, m, fftout);
+	int state = 0;
+	if (__atomic_compare_exchange_n(&SWIFFT_dispatchState, &state, 1, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+		SWIFFT_InitObject_AVX(&SWIFFT_isetObjects[SWIFFT_ISET_AVX]);
+		SWIFFT_InitObject_AVX2(&SWIFFT_isetObjects[SWIFFT_ISET_AVX2]);
+		SWIFFT_InitObject_AVX512(&SWIFFT_isetObjects[SWIFFT_ISET_AVX512]);
+		SWIFFT_InitObject_AVX512BW(&SWIFFT_isetObjects[SWIFFT_ISET_AVX512BW]);
+		swifft_iset_t iset = SWIFFT_GetBestIset();
+		// without any supported instruction-set, SWIFFT_ISET_NONE is selected, whose object has no functions
+		__atomic_store_n(&SWIFFT_selectedIset, iset, __ATOMIC_RELAXED);
+		__atomic_store_n(&SWIFFT_dispatchState, 2, __ATOMIC_RELEASE);
+	} else {
+		while (__atomic_load_n(&SWIFFT_dispatchState, __ATOMIC_ACQUIRE) != 2) {
+			// another thread is initializing
+		}
+	}
 }
 
-void SWIFFT_fftsum(const int16_t * LIBSWIFFT_RESTRICT ikey,
-	const int16_t * LIBSWIFFT_RESTRICT ifftout, int m, int16_t * LIBSWIFFT_RESTRICT iout)
+//! \brief Returns the SWIFFT object for the instruction-set selected for the main API.
+static inline const swifft_object_t * SWIFFT_GetDispatchObject(void)
 {
-	SWIFFT_ISET_NAME(SWIFFT_fftsum_)(ikey, ifftout, m, iout);
+	if (__builtin_expect(__atomic_load_n(&SWIFFT_dispatchState, __ATOMIC_ACQUIRE) != 2, 0)) {
+		SWIFFT_InitDispatch();
+	}
+	return &SWIFFT_isetObjects[__atomic_load_n(&SWIFFT_selectedIset, __ATOMIC_RELAXED)];
 }
 
-//! \brief Converts from base-257 to base-256.
+//! Dispatches to a function of the SWIFFT object for the selected instruction-set
+#define SWIFFT_DISPATCH(name) (SWIFFT_GetDispatchObject()->name)
+
+//! \brief Checks whether an instruction-set is supported by the running platform.
 //!
-//! vals array is assumed to have n digits in base 257.
-//! Assume that most significiant is last.
-//! output in vals is the same n numbers encoded in base 256.
+//! \param[in] iset the instruction-set to check.
+//! \returns non-zero if supported, 0 otherwise.
+int SWIFFT_IsIsetSupported(swifft_iset_t iset)
+{
+	__builtin_cpu_init();
+	switch (iset) {
+	case SWIFFT_ISET_AVX:
+		return __builtin_cpu_supports("avx");
+	case SWIFFT_ISET_AVX2:
+		return __builtin_cpu_supports("avx2");
+	case SWIFFT_ISET_AVX512:
+		return __builtin_cpu_supports("avx512f");
+	case SWIFFT_ISET_AVX512BW:
+		return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512vl");
+	default:
+		return 0;
+	}
+}
+
+//! \brief Returns the most advanced instruction-set supported by the running platform.
 //!
-//! \param[in,out] vals the vals array.
-//! \param[in] n the length of the vals array.
-static void ToBase256(Z1vec * vals, int n)
+//! \returns the instruction-set, or SWIFFT_ISET_NONE if none is supported.
+swifft_iset_t SWIFFT_GetBestIset(void)
 {
-	Z1vec Z1_255 = Z1CONST(255), Z1_8 = Z1CONST(8);
-	int i;
-	for (i=n-1; i>0; i--) {
-		int j;
-		for (j=i-1; j<n-1; j++) {
-			Z1vec v = vals[j] + vals[j+1];
-			vals[j] = v & Z1_255;
-			vals[j+1] += (v >> Z1_8);
+	int iset;
+	for (iset=SWIFFT_ISET_COUNT-1; iset>SWIFFT_ISET_NONE; iset--) {
+		if (SWIFFT_IsIsetSupported((swifft_iset_t)iset)) {
+			return (swifft_iset_t)iset;
 		}
 	}
+	return SWIFFT_ISET_NONE;
 }
 
-LIBSWIFFT_STATIC_ASSERT(8 * SWIFFT_W == SWIFFT_N, SWIFFT_N_must_be_8_times_SWIFFT_W);
-#define SWIFFT_OUTPUT_Z1_SIZE (SWIFFT_N / SWIFFT_W)
-#define SWIFFT_COMPACT_TRANSPOSE_SIZE 8
+//! \brief Returns the instruction-set currently used by this API.
+//! Initially, this is the one returned by SWIFFT_GetBestIset.
+//!
+//! \returns the instruction-set, or SWIFFT_ISET_NONE if none is supported, in which case the rest of this API
+//! must not be used.
+swifft_iset_t SWIFFT_GetIset(void)
+{
+	SWIFFT_GetDispatchObject();
+	return __atomic_load_n(&SWIFFT_selectedIset, __ATOMIC_RELAXED);
+}
+
+//! \brief Selects the instruction-set to be used by this API.
+//! The selection applies to subsequent calls from all threads.
+//!
+//! \param[in] iset the instruction-set to select.
+//! \returns 0 on success, or -1 if the instruction-set is not supported by the running platform.
+int SWIFFT_SetIset(swifft_iset_t iset)
+{
+	if (!SWIFFT_IsIsetSupported(iset)) {
+		return -1;
+	}
+	SWIFFT_GetDispatchObject();
+	__atomic_store_n(&SWIFFT_selectedIset, iset, __ATOMIC_RELAXED);
+	return 0;
+}
 
-#ifdef __SSE2__
-	#include <string.h>
-	#include "transpose_8x8_16_sse2.inl"
-	LIBSWIFFT_STATIC_ASSERT(sizeof(Z1vec) == sizeof(__m128i), Z1vec_and___m128i_must_have_the_same_size);
-	LIBSWIFFT_STATIC_ASSERT(sizeof(BitSequence)*SWIFFT_OUTPUT_BLOCK_SIZE == sizeof(Z1vec)*SWIFFT_OUTPUT_Z1_SIZE, output_and_transposed_arrays_must_have_the_same_size);
+//! \brief Returns the name of an instruction-set, e.g., "AVX2".
+//!
+//! \param[in] iset the instruction-set.
+//! \returns the name, or "NONE" for an unknown instruction-set.
+const char * SWIFFT_GetIsetName(swifft_iset_t iset)
+{
+	switch (iset) {
+	case SWIFFT_ISET_AVX:
+		return "AVX";
+	case SWIFFT_ISET_AVX2:
+		return "AVX2";
+	case SWIFFT_ISET_AVX512:
+		return "AVX512";
+	case SWIFFT_ISET_AVX512BW:
+		return "AVX512BW";
+	default:
+		return "NONE";
+	}
+}
+
+//! \brief Initializes a SWIFFT key from its elements.
+//! The element at index 64*i+j multiplies the j-th element of the FFT of the i-th 64 input bits,
+//! the same as for the built-in key.
+//!
+//! \param[out] key the SWIFFT key to initialize.
+//! \param[in] values the elements of the key, taken mod 257.
+void SWIFFT_KeyInit(swifft_key_t * key, const int16_t values[SWIFFT_KEY_SIZE])
+{
+	SWIFFT_ALIGN int16_t centered[SWIFFT_KEY_SIZE];
+	int log2O,i,k;
+	for (i=0; i<SWIFFT_KEY_SIZE; i++) {
+		int value = values[i] % SWIFFT_P;
+		// centered to {-128,..,128}
+		value += value > SWIFFT_P/2 ? -SWIFFT_P : value < -(SWIFFT_P/2) ? SWIFFT_P : 0;
+		centered[i] = (int16_t)value;
+	}
+	for (log2O=0; log2O<SWIFFT_KEY_LAYOUTS; log2O++) {
+		// the same layout as of SWIFFT_PI_keyO, for wide SWIFFT vectors of 1<<log2O SWIFFT vectors
+		int O = 1 << log2O;
+		int16_t *keyO = key->layouts + log2O*SWIFFT_KEY_SIZE;
+		for (i=0; i<SWIFFT_M; i++) {
+			for (k=0; k<8; k++) {
+				memcpy(keyO + ((((i >> log2O) * 8 + k) * O + (i & (O - 1))) << SWIFFT_LOG2_W),
+					centered + (((i * 8) + k) << SWIFFT_LOG2_W), SWIFFT_W*sizeof(int16_t));
+			}
+		}
+	}
+}
+
+//! \brief Allocates memory-aligned SWIFFT keys, to be initialized using SWIFFT_KeyInit.
+//! On request, the memory is aligned to a huge page and advised for huge pages where supported,
+//! to reduce TLB misses when hashing with many keys.
+//!
+//! \param[in] nkeys the number of keys to allocate.
+//! \param[in] hugePages non-zero for requesting huge pages.
+//! \returns the allocated keys, or NULL on failure.
+swifft_key_t * SWIFFT_KeyAlloc(int nkeys, int hugePages)
+{
+	size_t alignment = hugePages ? SWIFFT_HUGE_PAGE_SIZE : SWIFFT_ALIGNMENT;
+	size_t size = ((size_t)nkeys * sizeof(swifft_key_t) + alignment - 1) & ~(alignment - 1);
+	void *keys = NULL;
+	if (nkeys <= 0 || posix_memalign(&keys, alignment, size) != 0) {
+		return NULL;
+	}
+#ifdef MADV_HUGEPAGE
+	if (hugePages) {
+		// only advice, so failing is harmless
+		madvise(keys, size, MADV_HUGEPAGE);
+	}
 #endif
+	return (swifft_key_t *)keys;
+}
+
+//! \brief Frees SWIFFT keys allocated using SWIFFT_KeyAlloc.
+//!
+//! \param[in] keys the keys to free, or NULL.
+void SWIFFT_KeyFree(swifft_key_t * keys)
+{
+	free(keys);
+}
+
+void SWIFFT_fft(const BitSequence * LIBSWIFFT_RESTRICT input, const BitSequence * LIBSWIFFT_RESTRICT sign, int m, int16_t * LIBSWIFFT_RESTRICT fftout)
+{
+	SWIFFT_DISPATCH(fft.SWIFFT_fft)(input, sign, m, fftout);
+}
+
+void SWIFFT_fftsum(const int16_t * LIBSWIFFT_RESTRICT ikey,
+	const int16_t * LIBSWIFFT_RESTRICT ifftout, int m, int16_t * LIBSWIFFT_RESTRICT iout)
+{
+	SWIFFT_DISPATCH(fft.SWIFFT_fftsum)(ikey, ifftout, m, iout);
+}
 
 //! \brief Compacts a hash value of SWIFFT.
 //! The result is not composable with other compacted hash values.
@@ -75,68 +233,7 @@ LIBSWIFFT_STATIC_ASSERT(8 * SWIFFT_W == SWIFFT_N, SWIFFT_N_must_be_8_times_SWIFF
 void SWIFFT_Compact(const BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
 	BitSequence compact[SWIFFT_COMPACT_BLOCK_SIZE])
 {
-	//
-	// The 8*8 output int16_ts needs to be transposed before and after
-	// SIMD base change.
-	// This could be avoided by defining the base change differently
-	// but then a transpose like operation would have to be performed
-	// by the normal (Non-SIMD) version.
-	//
-#ifdef __SSE2__
-	__m128i transposed[SWIFFT_OUTPUT_Z1_SIZE];
-	memcpy(transposed, output, sizeof(BitSequence)*SWIFFT_OUTPUT_BLOCK_SIZE);
-	transpose_8x8_16_sse2(transposed);
-	ToBase256((Z1vec *) transposed, SWIFFT_OUTPUT_Z1_SIZE);
-	int16_t * tin = ((int16_t *) transposed) + ((SWIFFT_COMPACT_TRANSPOSE_SIZE - 1) * SWIFFT_COMPACT_TRANSPOSE_SIZE);
-	int carry = 0;
-	int i;
-	for (i=0; i<SWIFFT_OUTPUT_Z1_SIZE; i++,tin++) {
-		// move out carry bit to avoid saturation
-		carry |= ((*tin>>8)<<i);
-		*tin &= 255;
-	}
-	transpose_8x8_16_sse2(transposed);
-	__m128i * ztin = transposed;
-	__m128i * cout = (__m128i *) compact;
-	for (i=0; i<SWIFFT_OUTPUT_Z1_SIZE/2; i++) {
-		__m128i a = *ztin++;
-		__m128i b = *ztin++;
-		// compact 16-bit elements to 8-bit ones: saturation is avoided
-		*cout++ = _mm_packus_epi16(a, b);
-	}
-	// ignore carry
-#else
-	Z1vec transposed[SWIFFT_OUTPUT_Z1_SIZE];
-	int16_t *tin = (int16_t *) output;
-	int16_t *tout = (int16_t *) transposed;
-	int i;
-	for (i=0; i<SWIFFT_OUTPUT_Z1_SIZE; i++,tin+=SWIFFT_COMPACT_TRANSPOSE_SIZE,tout++) {
-		tout[0] = tin[0];
-		tout[8] = tin[1];
-		tout[16] = tin[2];
-		tout[24] = tin[3];
-		tout[32] = tin[4];
-		tout[40] = tin[5];
-		tout[48] = tin[6];
-		tout[56] = tin[7];
-	}
-	ToBase256(transposed, SWIFFT_OUTPUT_Z1_SIZE);
-	tin = (int16_t *) transposed;
-	BitSequence *cout = compact;
-	int carry = 0;
-	for (i=0; i<SWIFFT_OUTPUT_Z1_SIZE; i++,tin++,cout+=8) {
-		cout[0] = tin[0];
-		cout[1] = tin[8];
-		cout[2] = tin[16];
-		cout[3] = tin[24];
-		cout[4] = tin[32];
-		cout[5] = tin[40];
-		cout[6] = tin[48];
-		cout[7] = tin[56]&255;
-		carry |= ((tin[56]>>8)<<i);
-	}
-	// ignore carry
-#endif
+	SWIFFT_DISPATCH(hash.SWIFFT_Compact)(output, compact);
 }
 
 //! \brief Sets a constant value at each SWIFFT hash value element.
@@ -146,7 +243,7 @@ void SWIFFT_Compact(const BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
 void SWIFFT_ConstSet(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
 	const int16_t operand)
 {
-	SWIFFT_ISET_NAME(SWIFFT_ConstSet_)(output, operand);
+	SWIFFT_DISPATCH(arith.SWIFFT_ConstSet)(output, operand);
 }
 
 //! \brief Adds a constant value to each SWIFFT hash value element.
@@ -156,7 +253,7 @@ void SWIFFT_ConstSet(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
 void SWIFFT_ConstAdd(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
 	const int16_t operand)
 {
-	SWIFFT_ISET_NAME(SWIFFT_ConstAdd_)(output, operand);
+	SWIFFT_DISPATCH(arith.SWIFFT_ConstAdd)(output, operand);
 }
 
 //! \brief Subtracts a constant value from each SWIFFT hash value element.
@@ -166,7 +263,7 @@ void SWIFFT_ConstAdd(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
 void SWIFFT_ConstSub(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
 	const int16_t operand)
 {
-	SWIFFT_ISET_NAME(SWIFFT_ConstSub_)(output, operand);
+	SWIFFT_DISPATCH(arith.SWIFFT_ConstSub)(output, operand);
 }
 
 //! \brief Multiply a constant value into each SWIFFT hash value element.
@@ -176,7 +273,7 @@ void SWIFFT_ConstSub(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
 void SWIFFT_ConstMul(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
 	const int16_t operand)
 {
-	SWIFFT_ISET_NAME(SWIFFT_ConstMul_)(output, operand);
+	SWIFFT_DISPATCH(arith.SWIFFT_ConstMul)(output, operand);
 }
 
 //! \brief Sets a SWIFFT hash value to another, element-wise.
@@ -186,7 +283,7 @@ void SWIFFT_ConstMul(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
 void SWIFFT_Set(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
 	const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE])
 {
-	SWIFFT_ISET_NAME(SWIFFT_Set_)(output, operand);
+	SWIFFT_DISPATCH(arith.SWIFFT_Set)(output, operand);
 }
 
 //! \brief Adds a SWIFFT hash value to another, element-wise.
@@ -196,7 +293,7 @@ void SWIFFT_Set(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
 void SWIFFT_Add(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
 	const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE])
 {
-	SWIFFT_ISET_NAME(SWIFFT_Add_)(output, operand);
+	SWIFFT_DISPATCH(arith.SWIFFT_Add)(output, operand);
 }
 
 //! \brief Subtracts a SWIFFT hash value from another, element-wise.
@@ -206,7 +303,7 @@ void SWIFFT_Add(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
 void SWIFFT_Sub(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
 	const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE])
 {
-	SWIFFT_ISET_NAME(SWIFFT_Sub_)(output, operand);
+	SWIFFT_DISPATCH(arith.SWIFFT_Sub)(output, operand);
 }
 
 //! \brief Multiplies a SWIFFT hash value from another, element-wise.
@@ -216,7 +313,51 @@ void SWIFFT_Sub(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
 void SWIFFT_Mul(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
 	const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE])
 {
-	SWIFFT_ISET_NAME(SWIFFT_Mul_)(output, operand);
+	SWIFFT_DISPATCH(arith.SWIFFT_Mul)(output, operand);
+}
+
+//! \brief Adds the product of two SWIFFT hash values to another, element-wise.
+//!
+//! \param[in,out] output the hash value of SWIFFT to modify.
+//! \param[in] operand1 the first hash value to multiply.
+//! \param[in] operand2 the second hash value to multiply.
+void SWIFFT_MulAdd(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
+	const BitSequence operand1[SWIFFT_OUTPUT_BLOCK_SIZE], const BitSequence operand2[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_DISPATCH(arith.SWIFFT_MulAdd)(output, operand1, operand2);
+}
+
+//! \brief Subtracts the product of two SWIFFT hash values from another, element-wise.
+//!
+//! \param[in,out] output the hash value of SWIFFT to modify.
+//! \param[in] operand1 the first hash value to multiply.
+//! \param[in] operand2 the second hash value to multiply.
+void SWIFFT_MulSub(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
+	const BitSequence operand1[SWIFFT_OUTPUT_BLOCK_SIZE], const BitSequence operand2[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_DISPATCH(arith.SWIFFT_MulSub)(output, operand1, operand2);
+}
+
+//! \brief Adds the product of a SWIFFT hash value and a constant value to another, element-wise.
+//!
+//! \param[in,out] output the hash value of SWIFFT to modify.
+//! \param[in] operand the hash value to multiply.
+//! \param[in] multiplier the constant value to multiply by.
+void SWIFFT_ConstMulAdd(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
+	const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE], const int16_t multiplier)
+{
+	SWIFFT_DISPATCH(arith.SWIFFT_ConstMulAdd)(output, operand, multiplier);
+}
+
+//! \brief Subtracts the product of a SWIFFT hash value and a constant value from another, element-wise.
+//!
+//! \param[in,out] output the hash value of SWIFFT to modify.
+//! \param[in] operand the hash value to multiply.
+//! \param[in] multiplier the constant value to multiply by.
+void SWIFFT_ConstMulSub(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
+	const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE], const int16_t multiplier)
+{
+	SWIFFT_DISPATCH(arith.SWIFFT_ConstMulSub)(output, operand, multiplier);
 }
 
 //! \brief Computes the result of a SWIFFT operation.
@@ -227,7 +368,7 @@ void SWIFFT_Mul(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
 void SWIFFT_Compute(const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE],
 	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
 {
-	SWIFFT_ISET_NAME(SWIFFT_Compute_)(input, output);
+	SWIFFT_DISPATCH(hash.SWIFFT_Compute)(input, output);
 }
 
 //! \brief Computes the result of a SWIFFT operation.
@@ -240,7 +381,7 @@ void SWIFFT_ComputeSigned(const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE],
 	const BitSequence sign[SWIFFT_INPUT_BLOCK_SIZE],
 	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
 {
-	SWIFFT_ISET_NAME(SWIFFT_ComputeSigned_)(input, sign, output);
+	SWIFFT_DISPATCH(hash.SWIFFT_ComputeSigned)(input, sign, output);
 }
 
 //! \brief Computes the FFT phase of SWIFFT for multiple blocks.
@@ -252,7 +393,7 @@ void SWIFFT_ComputeSigned(const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE],
 //! \param[out] fftout the blocks of FFT-output elements, totaling N*m.
 void SWIFFT_fftMultiple(int nblocks, const BitSequence * LIBSWIFFT_RESTRICT input, const BitSequence * LIBSWIFFT_RESTRICT sign, int m, int16_t * LIBSWIFFT_RESTRICT fftout)
 {
-	SWIFFT_ISET_NAME(SWIFFT_fftMultiple_)(nblocks, input, sign, m, fftout);
+	SWIFFT_DISPATCH(fft.SWIFFT_fftMultiple)(nblocks, input, sign, m, fftout);
 }
 
 //! \brief Computes the FFT-sum phase of SWIFFT for multiple blocks.
@@ -265,7 +406,7 @@ void SWIFFT_fftMultiple(int nblocks, const BitSequence * LIBSWIFFT_RESTRICT inpu
 void SWIFFT_fftsumMultiple(int nblocks, const int16_t * LIBSWIFFT_RESTRICT ikey,
         const int16_t * LIBSWIFFT_RESTRICT ifftout, int m, int16_t * LIBSWIFFT_RESTRICT iout)
 {
-	SWIFFT_ISET_NAME(SWIFFT_fftsumMultiple_)(nblocks, ikey, ifftout, m, iout);
+	SWIFFT_DISPATCH(fft.SWIFFT_fftsumMultiple)(nblocks, ikey, ifftout, m, iout);
 }
 
 //! \brief Compacts a hash value of SWIFFT for multiple blocks.
@@ -277,7 +418,83 @@ void SWIFFT_fftsumMultiple(int nblocks, const int16_t * LIBSWIFFT_RESTRICT ikey,
 void SWIFFT_CompactMultiple(int nblocks, const BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
         BitSequence compact[SWIFFT_COMPACT_BLOCK_SIZE])
 {
-	SWIFFT_ISET_NAME(SWIFFT_CompactMultiple_)(nblocks, output, compact);
+	SWIFFT_DISPATCH(hash.SWIFFT_CompactMultiple)(nblocks, output, compact);
+}
+
+//! \brief Compacts a hash value of SWIFFT, keeping the carry bits dropped by SWIFFT_Compact.
+//! Together with its carry bits, the compacted hash value is lossless, and SWIFFT_Decompact recovers the hash value from them.
+//!
+//! \param[in] output the hash value of SWIFFT, of size 128 bytes (1024 bit).
+//! \param[out] compact the compacted hash value of SWIFFT, of size 64 bytes (512 bit).
+//! \param[out] carry the carry bits of the compacted hash value, of size 1 byte (8 bit).
+void SWIFFT_CompactWithCarry(const BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
+	BitSequence compact[SWIFFT_COMPACT_BLOCK_SIZE], BitSequence carry[SWIFFT_COMPACT_CARRY_SIZE])
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_CompactWithCarry)(output, compact, carry);
+}
+
+//! \brief Compacts a hash value of SWIFFT, keeping the carry bits, for multiple blocks.
+//! The carry bits of all blocks are kept apart from the compacted hash values, so the latter are the same as by SWIFFT_CompactMultiple.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] output the hash value of SWIFFT, of size 128 bytes (1024 bit) per block.
+//! \param[out] compact the compacted hash value of SWIFFT, of size 64 bytes (512 bit) per block.
+//! \param[out] carry the carry bits of the compacted hash value, of size 1 byte (8 bit) per block.
+void SWIFFT_CompactWithCarryMultiple(int nblocks, const BitSequence * output,
+	BitSequence * compact, BitSequence * carry)
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_CompactWithCarryMultiple)(nblocks, output, compact, carry);
+}
+
+//! \brief Decompacts a compacted hash value of SWIFFT, given with its carry bits, back to the hash value.
+//! This is the inverse of SWIFFT_CompactWithCarry. The elements of the hash value are canonical, in the range {0,..,SWIFFT_P-1}.
+//!
+//! \param[in] compact the compacted hash value of SWIFFT, of size 64 bytes (512 bit).
+//! \param[in] carry the carry bits of the compacted hash value, of size 1 byte (8 bit).
+//! \param[out] output the hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_Decompact(const BitSequence compact[SWIFFT_COMPACT_BLOCK_SIZE],
+	const BitSequence carry[SWIFFT_COMPACT_CARRY_SIZE], BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_Decompact)(compact, carry, output);
+}
+
+//! \brief Decompacts a compacted hash value of SWIFFT, given with its carry bits, for multiple blocks.
+//! This is the inverse of SWIFFT_CompactWithCarryMultiple.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] compact the compacted hash value of SWIFFT, of size 64 bytes (512 bit) per block.
+//! \param[in] carry the carry bits of the compacted hash value, of size 1 byte (8 bit) per block.
+//! \param[out] output the hash value of SWIFFT, of size 128 bytes (1024 bit) per block.
+void SWIFFT_DecompactMultiple(int nblocks, const BitSequence * compact,
+	const BitSequence * carry, BitSequence * output)
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_DecompactMultiple)(nblocks, compact, carry, output);
+}
+
+//! \brief Tests whether pairs of compacted SWIFFT hash values are equal for multiple blocks.
+//! Compacted hash values are canonical, so they are compared bitwise.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] compact1 the first compacted hash values of SWIFFT, of size 64 bytes (512 bit) per block.
+//! \param[in] compact2 the second compacted hash values of SWIFFT, of size 64 bytes (512 bit) per block.
+//! \param[out] equal the bitmap of equality, of size ceil(nblocks/8) bytes, whose bit (i mod 8) of byte (i div 8) is set if and only if the i-th pair of blocks is equal.
+void SWIFFT_CompactEqualMultiple(int nblocks, const BitSequence * compact1, const BitSequence * compact2,
+	BitSequence * equal)
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_CompactEqualMultiple)(nblocks, compact1, compact2, equal);
+}
+
+//! \brief Finds the first of multiple compacted SWIFFT hash values that is equal to a given one.
+//! The search stops at the first equal block.
+//!
+//! \param[in] nblocks the number of blocks to search.
+//! \param[in] haystack the compacted hash values of SWIFFT to search, of size 64 bytes (512 bit) per block.
+//! \param[in] needle the compacted hash value of SWIFFT to search for, of size 64 bytes (512 bit).
+//! \returns the index of the first equal block, or -1 if none is equal.
+int SWIFFT_FindCompactMatch(int nblocks, const BitSequence * haystack,
+	const BitSequence needle[SWIFFT_COMPACT_BLOCK_SIZE])
+{
+	return SWIFFT_DISPATCH(hash.SWIFFT_FindCompactMatch)(nblocks, haystack, needle);
 }
 
 //! \brief Sets a constant value at each SWIFFT hash value element for multiple blocks.
@@ -288,7 +505,7 @@ void SWIFFT_CompactMultiple(int nblocks, const BitSequence output[SWIFFT_OUTPUT_
 void SWIFFT_ConstSetMultiple(int nblocks, BitSequence * output,
         const int16_t * operand)
 {
-	SWIFFT_ISET_NAME(SWIFFT_ConstSetMultiple_)(nblocks, output, operand);
+	SWIFFT_DISPATCH(arith.SWIFFT_ConstSetMultiple)(nblocks, output, operand);
 }
 
 //! \brief Adds a constant value to each SWIFFT hash value element for multiple blocks.
@@ -299,7 +516,7 @@ void SWIFFT_ConstSetMultiple(int nblocks, BitSequence * output,
 void SWIFFT_ConstAddMultiple(int nblocks, BitSequence * output,
         const int16_t * operand)
 {
-	SWIFFT_ISET_NAME(SWIFFT_ConstAddMultiple_)(nblocks, output, operand);
+	SWIFFT_DISPATCH(arith.SWIFFT_ConstAddMultiple)(nblocks, output, operand);
 }
 
 //! \brief Subtracts a constant value from each SWIFFT hash value element for multiple blocks.
@@ -310,7 +527,7 @@ void SWIFFT_ConstAddMultiple(int nblocks, BitSequence * output,
 void SWIFFT_ConstSubMultiple(int nblocks, BitSequence * output,
         const int16_t * operand)
 {
-	SWIFFT_ISET_NAME(SWIFFT_ConstSubMultiple_)(nblocks, output, operand);
+	SWIFFT_DISPATCH(arith.SWIFFT_ConstSubMultiple)(nblocks, output, operand);
 }
 
 //! \brief Multiply a constant value into each SWIFFT hash value element for multiple blocks.
@@ -321,7 +538,7 @@ void SWIFFT_ConstSubMultiple(int nblocks, BitSequence * output,
 void SWIFFT_ConstMulMultiple(int nblocks, BitSequence * output,
         const int16_t * operand)
 {
-	SWIFFT_ISET_NAME(SWIFFT_ConstMulMultiple_)(nblocks, output, operand);
+	SWIFFT_DISPATCH(arith.SWIFFT_ConstMulMultiple)(nblocks, output, operand);
 }
 
 //! \brief Sets a SWIFFT hash value to another, element-wise, for multiple blocks.
@@ -332,7 +549,7 @@ void SWIFFT_ConstMulMultiple(int nblocks, BitSequence * output,
 void SWIFFT_SetMultiple(int nblocks, BitSequence * output,
         const BitSequence * operand)
 {
-	SWIFFT_ISET_NAME(SWIFFT_SetMultiple_)(nblocks, output, operand);
+	SWIFFT_DISPATCH(arith.SWIFFT_SetMultiple)(nblocks, output, operand);
 }
 
 //! \brief Adds a SWIFFT hash value to another, element-wise, for multiple blocks.
@@ -343,7 +560,7 @@ void SWIFFT_SetMultiple(int nblocks, BitSequence * output,
 void SWIFFT_AddMultiple(int nblocks, BitSequence * output,
         const BitSequence * operand)
 {
-	SWIFFT_ISET_NAME(SWIFFT_AddMultiple_)(nblocks, output, operand);
+	SWIFFT_DISPATCH(arith.SWIFFT_AddMultiple)(nblocks, output, operand);
 }
 
 //! \brief Subtracts a SWIFFT hash value from another, element-wise, for multiple blocks.
@@ -354,7 +571,7 @@ void SWIFFT_AddMultiple(int nblocks, BitSequence * output,
 void SWIFFT_SubMultiple(int nblocks, BitSequence * output,
         const BitSequence * operand)
 {
-	SWIFFT_ISET_NAME(SWIFFT_SubMultiple_)(nblocks, output, operand);
+	SWIFFT_DISPATCH(arith.SWIFFT_SubMultiple)(nblocks, output, operand);
 }
 
 //! \brief Multiplies a SWIFFT hash value from another, element-wise, for multiple blocks.
@@ -365,7 +582,336 @@ void SWIFFT_SubMultiple(int nblocks, BitSequence * output,
 void SWIFFT_MulMultiple(int nblocks, BitSequence * output,
         const BitSequence * operand)
 {
-	SWIFFT_ISET_NAME(SWIFFT_MulMultiple_)(nblocks, output, operand);
+	SWIFFT_DISPATCH(arith.SWIFFT_MulMultiple)(nblocks, output, operand);
+}
+
+//! \brief Adds the product of two SWIFFT hash values to another, element-wise, for multiple blocks.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the hash value of SWIFFT to modify.
+//! \param[in] operand1 the first hash value to multiply.
+//! \param[in] operand2 the second hash value to multiply.
+void SWIFFT_MulAddMultiple(int nblocks, BitSequence * output,
+	const BitSequence * operand1, const BitSequence * operand2)
+{
+	SWIFFT_DISPATCH(arith.SWIFFT_MulAddMultiple)(nblocks, output, operand1, operand2);
+}
+
+//! \brief Subtracts the product of two SWIFFT hash values from another, element-wise, for multiple blocks.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the hash value of SWIFFT to modify.
+//! \param[in] operand1 the first hash value to multiply.
+//! \param[in] operand2 the second hash value to multiply.
+void SWIFFT_MulSubMultiple(int nblocks, BitSequence * output,
+	const BitSequence * operand1, const BitSequence * operand2)
+{
+	SWIFFT_DISPATCH(arith.SWIFFT_MulSubMultiple)(nblocks, output, operand1, operand2);
+}
+
+//! \brief Adds the product of a SWIFFT hash value and a constant value to another, element-wise, for multiple blocks.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the hash value of SWIFFT to modify, per block.
+//! \param[in] operand the hash value to multiply, per block.
+//! \param[in] multiplier the constant value to multiply by, per block.
+void SWIFFT_ConstMulAddMultiple(int nblocks, BitSequence * output,
+	const BitSequence * operand, const int16_t * multiplier)
+{
+	SWIFFT_DISPATCH(arith.SWIFFT_ConstMulAddMultiple)(nblocks, output, operand, multiplier);
+}
+
+//! \brief Subtracts the product of a SWIFFT hash value and a constant value from another, element-wise, for multiple blocks.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the hash value of SWIFFT to modify, per block.
+//! \param[in] operand the hash value to multiply, per block.
+//! \param[in] multiplier the constant value to multiply by, per block.
+void SWIFFT_ConstMulSubMultiple(int nblocks, BitSequence * output,
+	const BitSequence * operand, const int16_t * multiplier)
+{
+	SWIFFT_DISPATCH(arith.SWIFFT_ConstMulSubMultiple)(nblocks, output, operand, multiplier);
+}
+
+//! \brief Sets a SWIFFT hash value to another, element-wise, for multiple blocks with the same operand.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[out] output the hash value of SWIFFT to modify, per block.
+//! \param[in] operand the hash value to set to, for all blocks.
+void SWIFFT_SetBroadcast(int nblocks, BitSequence * output,
+	const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_DISPATCH(arith.SWIFFT_SetBroadcast)(nblocks, output, operand);
+}
+
+//! \brief Adds a SWIFFT hash value to another, element-wise, for multiple blocks with the same operand.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the hash value of SWIFFT to modify, per block.
+//! \param[in] operand the hash value to add, for all blocks.
+void SWIFFT_AddBroadcast(int nblocks, BitSequence * output,
+	const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_DISPATCH(arith.SWIFFT_AddBroadcast)(nblocks, output, operand);
+}
+
+//! \brief Subtracts a SWIFFT hash value from another, element-wise, for multiple blocks with the same operand.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the hash value of SWIFFT to modify, per block.
+//! \param[in] operand the hash value to subtract, for all blocks.
+void SWIFFT_SubBroadcast(int nblocks, BitSequence * output,
+	const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_DISPATCH(arith.SWIFFT_SubBroadcast)(nblocks, output, operand);
+}
+
+//! \brief Multiplies a SWIFFT hash value by another, element-wise, for multiple blocks with the same operand.
+//! The operand is centered once for all blocks.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the hash value of SWIFFT to modify, per block.
+//! \param[in] operand the hash value to multiply by, for all blocks.
+void SWIFFT_MulBroadcast(int nblocks, BitSequence * output,
+	const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_DISPATCH(arith.SWIFFT_MulBroadcast)(nblocks, output, operand);
+}
+
+//! \brief Sets SWIFFT hash values to the products of one SWIFFT hash value by constant values.
+//! The operand is centered once for all blocks, and each block of output is written without being read.
+//!
+//! \param[in] nblocks the number of blocks to operate on, one per constant value.
+//! \param[out] output the hash value of SWIFFT to set, per block.
+//! \param[in] operand the hash value to multiply, for all blocks.
+//! \param[in] multiplier the constant value to multiply by, per block.
+void SWIFFT_ConstMulOuter(int nblocks, BitSequence * output,
+	const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE], const int16_t * multiplier)
+{
+	SWIFFT_DISPATCH(arith.SWIFFT_ConstMulOuter)(nblocks, output, operand, multiplier);
+}
+
+//! \brief Computes a linear combination of SWIFFT hash values, element-wise.
+//! The sum of products is accumulated into 32-bit elements and reduced mod 257 once.
+//!
+//! \param[in] n the number of terms.
+//! \param[in] coeffs the coefficients of the terms.
+//! \param[in] operand the hash value of each term, per block, with elements in the range {0,..,SWIFFT_P-1},
+//! as output by LibSWIFFT; other elements must first be canonicalized using SWIFFT_Canonicalize.
+//! \param[out] output the hash value of SWIFFT to set to the linear combination.
+void SWIFFT_LinearCombination(int n, const int16_t * coeffs,
+        const BitSequence * operand, BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_DISPATCH(arith.SWIFFT_LinearCombination)(n, coeffs, operand, output);
+}
+
+//! \brief Computes linear combinations of SWIFFT hash values, element-wise, for multiple blocks.
+//! The linear combination for each output block has its own n coefficients and n operand blocks.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] n the number of terms per block.
+//! \param[in] coeffs the coefficients of the terms, n per block.
+//! \param[in] operand the hash value of each term, n blocks per block, with elements in the range {0,..,SWIFFT_P-1},
+//! as output by LibSWIFFT; other elements must first be canonicalized using SWIFFT_CanonicalizeMultiple.
+//! \param[out] output the hash value of SWIFFT to set to the linear combination, per block.
+void SWIFFT_LinearCombinationMultiple(int nblocks, int n, const int16_t * coeffs,
+        const BitSequence * operand, BitSequence * output)
+{
+	SWIFFT_DISPATCH(arith.SWIFFT_LinearCombinationMultiple)(nblocks, n, coeffs, operand, output);
+}
+
+//! \brief Multiplies a matrix by a vector of SWIFFT hash values, over Z_257.
+//! Computes output[i] = sum_j matrix[i*n+j]*operand[j], element-wise, for i in {0,..,k-1}.
+//!
+//! \param[in] k the number of rows of the matrix.
+//! \param[in] n the number of columns of the matrix.
+//! \param[in] matrix the matrix of k*n coefficients, in row-major order.
+//! \param[in] operand the vector of n hash values.
+//! \param[out] output the resulting vector of k hash values.
+void SWIFFT_MatMulOutputs(int k, int n, const int16_t * matrix,
+	const BitSequence * operand, BitSequence * output)
+{
+	SWIFFT_DISPATCH(arith.SWIFFT_MatMulOutputs)(k, n, matrix, operand, output);
+}
+
+//! \brief Transforms a SWIFFT hash value from the evaluation form to the coefficient form.
+//! The i-th element of a hash value is the evaluation at OMEGA^(2i+1), for the 128-th root of unity OMEGA = 42,
+//! of a polynomial in Z_{257}[x]/(x^64+1), whose i-th coefficient becomes the i-th element.
+//!
+//! \param[in,out] output the hash value of SWIFFT to transform, of size 128 bytes (1024 bit).
+void SWIFFT_ToCoefficients(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_DISPATCH(arith.SWIFFT_ToCoefficients)(output);
+}
+
+//! \brief Transforms a SWIFFT hash value from the coefficient form to the evaluation form.
+//! The i-th coefficient of a polynomial in Z_{257}[x]/(x^64+1), given as the i-th element, becomes its evaluation at
+//! OMEGA^(2i+1), for the 128-th root of unity OMEGA = 42, the same as for hash values. This is the inverse of SWIFFT_ToCoefficients.
+//!
+//! \param[in,out] output the hash value of SWIFFT to transform, of size 128 bytes (1024 bit).
+void SWIFFT_FromCoefficients(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_DISPATCH(arith.SWIFFT_FromCoefficients)(output);
+}
+
+//! \brief Transforms multiple SWIFFT hash values from the evaluation form to the coefficient form.
+//! This is SWIFFT_ToCoefficients for each block.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the blocks of hash values of SWIFFT to transform, each of size 128 bytes (1024 bit).
+void SWIFFT_ToCoefficientsMultiple(int nblocks, BitSequence * output)
+{
+	SWIFFT_DISPATCH(arith.SWIFFT_ToCoefficientsMultiple)(nblocks, output);
+}
+
+//! \brief Transforms multiple SWIFFT hash values from the coefficient form to the evaluation form.
+//! This is SWIFFT_FromCoefficients for each block.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the blocks of hash values of SWIFFT to transform, each of size 128 bytes (1024 bit).
+void SWIFFT_FromCoefficientsMultiple(int nblocks, BitSequence * output)
+{
+	SWIFFT_DISPATCH(arith.SWIFFT_FromCoefficientsMultiple)(nblocks, output);
+}
+
+//! \brief Canonicalizes a SWIFFT hash value, reducing each element mod 257 to the range {0,..,SWIFFT_P-1}.
+//! Hash values computed by LibSWIFFT are canonical already; this is for elements coming from elsewhere, e.g. in the range of a partial reduction.
+//!
+//! \param[in,out] output the hash value of SWIFFT to canonicalize, of size 128 bytes (1024 bit).
+void SWIFFT_Canonicalize(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_DISPATCH(arith.SWIFFT_Canonicalize)(output);
+}
+
+//! \brief Canonicalizes multiple SWIFFT hash values.
+//! This is SWIFFT_Canonicalize for each block.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the blocks of hash values of SWIFFT to canonicalize, each of size 128 bytes (1024 bit).
+void SWIFFT_CanonicalizeMultiple(int nblocks, BitSequence * output)
+{
+	SWIFFT_DISPATCH(arith.SWIFFT_CanonicalizeMultiple)(nblocks, output);
+}
+
+//! \brief Tests whether two SWIFFT hash values are equal.
+//! Elements are compared mod 257, so a non-canonical element compares equal to its canonical one.
+//!
+//! \param[in] operand1 the first hash value of SWIFFT, of size 128 bytes (1024 bit).
+//! \param[in] operand2 the second hash value of SWIFFT, of size 128 bytes (1024 bit).
+//! \returns 1 if the hash values are equal, 0 otherwise.
+int SWIFFT_Equal(const BitSequence operand1[SWIFFT_OUTPUT_BLOCK_SIZE], const BitSequence operand2[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	return SWIFFT_DISPATCH(arith.SWIFFT_Equal)(operand1, operand2);
+}
+
+//! \brief Tests whether pairs of SWIFFT hash values are equal for multiple blocks.
+//! This is SWIFFT_Equal for each pair of blocks, with the results packed into a bitmap.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] operand1 the first hash values of SWIFFT, of size 128 bytes (1024 bit) per block.
+//! \param[in] operand2 the second hash values of SWIFFT, of size 128 bytes (1024 bit) per block.
+//! \param[out] equal the bitmap of equality, of size ceil(nblocks/8) bytes, whose bit (i mod 8) of byte (i div 8) is set if and only if the i-th pair of blocks is equal.
+void SWIFFT_EqualMultiple(int nblocks, const BitSequence * operand1, const BitSequence * operand2,
+	BitSequence * equal)
+{
+	SWIFFT_DISPATCH(arith.SWIFFT_EqualMultiple)(nblocks, operand1, operand2, equal);
+}
+
+//! \brief Finds the first of multiple SWIFFT hash values that is equal to a given one.
+//! Elements are compared mod 257, as in SWIFFT_Equal. The search stops at the first equal block.
+//!
+//! \param[in] nblocks the number of blocks to search.
+//! \param[in] haystack the hash values of SWIFFT to search, of size 128 bytes (1024 bit) per block.
+//! \param[in] needle the hash value of SWIFFT to search for, of size 128 bytes (1024 bit).
+//! \returns the index of the first equal block, or -1 if none is equal.
+int SWIFFT_FindMatch(int nblocks, const BitSequence * haystack,
+	const BitSequence needle[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	return SWIFFT_DISPATCH(arith.SWIFFT_FindMatch)(nblocks, haystack, needle);
+}
+
+//! \brief Sums SWIFFT hash values of multiple blocks, element-wise.
+//! Partial sums are accumulated with lazy reduction, in parallel when built with OpenMP.
+//!
+//! \param[in] nblocks the number of blocks to sum.
+//! \param[in] operand the hash value to sum, per block, with elements in the range {0,..,SWIFFT_P-1}.
+//! \param[out] output the hash value of SWIFFT to set to the sum.
+void SWIFFT_SumMultiple(int nblocks, const BitSequence * operand,
+        BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_DISPATCH(arith.SWIFFT_SumMultiple)(nblocks, operand, output);
+}
+
+//! \brief Multiplies SWIFFT hash values of multiple blocks, element-wise.
+//! Partial products are computed in parallel when built with OpenMP.
+//!
+//! \param[in] nblocks the number of blocks to multiply.
+//! \param[in] operand the hash value to multiply, per block, with elements in the range {0,..,SWIFFT_P-1}.
+//! \param[out] output the hash value of SWIFFT to set to the product.
+void SWIFFT_ProductMultiple(int nblocks, const BitSequence * operand,
+        BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_DISPATCH(arith.SWIFFT_ProductMultiple)(nblocks, operand, output);
+}
+
+//! \brief Initializes a SWIFFT accumulator to a zero sum.
+//!
+//! \param[out] accumulator the SWIFFT accumulator to initialize.
+void SWIFFT_AccumulatorInit(swifft_accumulator_t * accumulator)
+{
+	SWIFFT_DISPATCH(arith.SWIFFT_AccumulatorInit)(accumulator);
+}
+
+//! \brief Adds a SWIFFT hash value to a SWIFFT accumulator, element-wise, without reducing it.
+//!
+//! \param[in,out] accumulator the SWIFFT accumulator to modify.
+//! \param[in] operand the hash value to add, with elements in the range {0,..,SWIFFT_P-1}.
+void SWIFFT_AccumulatorAdd(swifft_accumulator_t * accumulator,
+        const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_DISPATCH(arith.SWIFFT_AccumulatorAdd)(accumulator, operand);
+}
+
+//! \brief Subtracts a SWIFFT hash value from a SWIFFT accumulator, element-wise, without reducing it.
+//!
+//! \param[in,out] accumulator the SWIFFT accumulator to modify.
+//! \param[in] operand the hash value to subtract, with elements in the range {0,..,SWIFFT_P-1}.
+void SWIFFT_AccumulatorSub(swifft_accumulator_t * accumulator,
+        const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_DISPATCH(arith.SWIFFT_AccumulatorSub)(accumulator, operand);
+}
+
+//! \brief Adds SWIFFT hash values of multiple blocks to a SWIFFT accumulator, element-wise, without reducing it.
+//!
+//! \param[in,out] accumulator the SWIFFT accumulator to modify.
+//! \param[in] nblocks the number of blocks to add.
+//! \param[in] operand the hash value to add, per block, with elements in the range {0,..,SWIFFT_P-1}.
+void SWIFFT_AccumulatorAddMultiple(swifft_accumulator_t * accumulator, int nblocks,
+        const BitSequence * operand)
+{
+	SWIFFT_DISPATCH(arith.SWIFFT_AccumulatorAddMultiple)(accumulator, nblocks, operand);
+}
+
+//! \brief Subtracts SWIFFT hash values of multiple blocks from a SWIFFT accumulator, element-wise, without reducing it.
+//!
+//! \param[in,out] accumulator the SWIFFT accumulator to modify.
+//! \param[in] nblocks the number of blocks to subtract.
+//! \param[in] operand the hash value to subtract, per block, with elements in the range {0,..,SWIFFT_P-1}.
+void SWIFFT_AccumulatorSubMultiple(swifft_accumulator_t * accumulator, int nblocks,
+        const BitSequence * operand)
+{
+	SWIFFT_DISPATCH(arith.SWIFFT_AccumulatorSubMultiple)(accumulator, nblocks, operand);
+}
+
+//! \brief Gets the sum of a SWIFFT accumulator as a SWIFFT hash value, reduced mod 257.
+//!
+//! \param[in] accumulator the SWIFFT accumulator.
+//! \param[out] output the hash value of SWIFFT to set to the sum.
+void SWIFFT_AccumulatorGet(const swifft_accumulator_t * accumulator,
+        BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_DISPATCH(arith.SWIFFT_AccumulatorGet)(accumulator, output);
 }
 
 //! \brief Computes the result of multiple SWIFFT operations.
@@ -376,7 +922,7 @@ void SWIFFT_MulMultiple(int nblocks, BitSequence * output,
 //! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
 void SWIFFT_ComputeMultiple(int nblocks, const BitSequence * input, BitSequence * output)
 {
-	SWIFFT_ISET_NAME(SWIFFT_ComputeMultiple_)(nblocks, input, output);
+	SWIFFT_DISPATCH(hash.SWIFFT_ComputeMultiple)(nblocks, input, output);
 }
 
 //! \brief Computes the result of multiple SWIFFT operations.
@@ -389,7 +935,553 @@ void SWIFFT_ComputeMultiple(int nblocks, const BitSequence * input, BitSequence
 void SWIFFT_ComputeMultipleSigned(int nblocks, const BitSequence * input,
 	const BitSequence * sign, BitSequence * output)
 {
-	SWIFFT_ISET_NAME(SWIFFT_ComputeMultipleSigned_)(nblocks, input, sign, output);
+	SWIFFT_DISPATCH(hash.SWIFFT_ComputeMultipleSigned)(nblocks, input, sign, output);
+}
+
+//! \brief Computes the result of a SWIFFT operation with a given key.
+//! The result is composable with other hash values computed with the same key.
+//!
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the input of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ComputeKeyed(const swifft_key_t * key, const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE],
+	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_ComputeKeyed)(key, input, output);
+}
+
+//! \brief Computes the result of a SWIFFT operation with a given key.
+//! The result is composable with other hash values computed with the same key.
+//!
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the input of 256 bytes (2048 bit).
+//! \param[in] sign the sign bits corresponding to the input of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ComputeSignedKeyed(const swifft_key_t * key, const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE],
+	const BitSequence sign[SWIFFT_INPUT_BLOCK_SIZE], BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_ComputeSignedKeyed)(key, input, sign, output);
+}
+
+//! \brief Computes the result of multiple SWIFFT operations with a given key.
+//! The result is composable with other hash values computed with the same key.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void SWIFFT_ComputeMultipleKeyed(int nblocks, const swifft_key_t * key, const BitSequence * input,
+	BitSequence * output)
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_ComputeMultipleKeyed)(nblocks, key, input, output);
+}
+
+//! \brief Computes the result of multiple SWIFFT operations with a given key.
+//! The result is composable with other hash values computed with the same key.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 256 bytes (2048 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void SWIFFT_ComputeMultipleSignedKeyed(int nblocks, const swifft_key_t * key, const BitSequence * input,
+	const BitSequence * sign, BitSequence * output)
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_ComputeMultipleSignedKeyed)(nblocks, key, input, sign, output);
+}
+
+//! \brief Computes the results of a SWIFFT operation with multiple keys.
+//! The results are the same as of SWIFFT_ComputeKeyed with each key, but the FFT phase is computed once.
+//!
+//! \param[in] nkeys the number of keys.
+//! \param[in] keys the SWIFFT keys, initialized using SWIFFT_KeyInit.
+//! \param[in] input the input of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash values of SWIFFT, one for each key, each of size 128 bytes (1024 bit).
+void SWIFFT_ComputeMultiKey(int nkeys, const swifft_key_t * keys, const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE],
+	BitSequence * output)
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_ComputeMultiKey)(nkeys, keys, input, output);
+}
+
+//! \brief Computes the results of a SWIFFT operation with multiple keys.
+//! The results are the same as of SWIFFT_ComputeSignedKeyed with each key, but the FFT phase is computed once.
+//!
+//! \param[in] nkeys the number of keys.
+//! \param[in] keys the SWIFFT keys, initialized using SWIFFT_KeyInit.
+//! \param[in] input the input of 256 bytes (2048 bit).
+//! \param[in] sign the sign bits corresponding to the input of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash values of SWIFFT, one for each key, each of size 128 bytes (1024 bit).
+void SWIFFT_ComputeSignedMultiKey(int nkeys, const swifft_key_t * keys, const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE],
+	const BitSequence sign[SWIFFT_INPUT_BLOCK_SIZE], BitSequence * output)
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_ComputeSignedMultiKey)(nkeys, keys, input, sign, output);
+}
+
+//! \brief Computes the results of multiple SWIFFT operations with multiple keys.
+//! The results are the same as of SWIFFT_ComputeMultipleKeyed with each key, but the FFT phase is computed
+//! once per block, and the blocks are processed in groups whose FFT-outputs stay in the L1 cache across keys.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] nkeys the number of keys.
+//! \param[in] keys the SWIFFT keys, initialized using SWIFFT_KeyInit.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, for each block of input one for each key, each of size 128 bytes (1024 bit).
+void SWIFFT_ComputeMultipleMultiKey(int nblocks, int nkeys, const swifft_key_t * keys, const BitSequence * input,
+	BitSequence * output)
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_ComputeMultipleMultiKey)(nblocks, nkeys, keys, input, output);
+}
+
+//! \brief Computes the results of multiple SWIFFT operations with multiple keys.
+//! The results are the same as of SWIFFT_ComputeMultipleSignedKeyed with each key, but the FFT phase is computed
+//! once per block, and the blocks are processed in groups whose FFT-outputs stay in the L1 cache across keys.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] nkeys the number of keys.
+//! \param[in] keys the SWIFFT keys, initialized using SWIFFT_KeyInit.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 256 bytes (2048 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, for each block of input one for each key, each of size 128 bytes (1024 bit).
+void SWIFFT_ComputeMultipleSignedMultiKey(int nblocks, int nkeys, const swifft_key_t * keys, const BitSequence * input,
+	const BitSequence * sign, BitSequence * output)
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_ComputeMultipleSignedMultiKey)(nblocks, nkeys, keys, input, sign, output);
+}
+
+//! \brief Derives a SWIFFT key from a seed.
+//! The elements of the key are sampled uniformly by rejection from the 16-bit little-endian words of the
+//! ChaCha20 keystream, as specified in RFC 8439, keyed by the seed with a zero nonce and a block counter
+//! starting at 0. A word w other than 65535 is sampled as the element w mod 257, in the order of SWIFFT_KeyInit.
+//! The derived key is the same for all instruction-sets.
+//!
+//! \param[in] seed the seed of 32 bytes (256 bit).
+//! \param[out] key the SWIFFT key to derive.
+void SWIFFT_DeriveKey(const BitSequence seed[SWIFFT_KEY_SEED_SIZE], swifft_key_t * key)
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_DeriveKey)(seed, key);
+}
+
+//! \brief Computes the result of a SWIFFT operation on a short input.
+//! The result is the same as for the input padded with zeros to 256 bytes.
+//!
+//! \param[in] input the input of 128 bytes (1024 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_Compute128(const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE_128],
+	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_Compute128)(input, output);
+}
+
+//! \brief Computes the result of a SWIFFT operation on a short input.
+//! The result is the same as for the input and sign bits padded with zeros to 256 bytes.
+//!
+//! \param[in] input the input of 128 bytes (1024 bit).
+//! \param[in] sign the sign bits corresponding to the input of 128 bytes (1024 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ComputeSigned128(const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE_128],
+	const BitSequence sign[SWIFFT_INPUT_BLOCK_SIZE_128],
+	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_ComputeSigned128)(input, sign, output);
+}
+
+//! \brief Computes the result of multiple SWIFFT operations on short inputs.
+//! The result is the same as for the inputs padded with zeros to 256 bytes.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] input the blocks of input, each of 128 bytes (1024 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void SWIFFT_ComputeMultiple128(int nblocks, const BitSequence * input, BitSequence * output)
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_ComputeMultiple128)(nblocks, input, output);
+}
+
+//! \brief Computes the result of multiple SWIFFT operations on short inputs.
+//! The result is the same as for the inputs and sign bits padded with zeros to 256 bytes.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] input the blocks of input, each of 128 bytes (1024 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 128 bytes (1024 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void SWIFFT_ComputeMultipleSigned128(int nblocks, const BitSequence * input,
+	const BitSequence * sign, BitSequence * output)
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_ComputeMultipleSigned128)(nblocks, input, sign, output);
+}
+
+//! \brief Computes the result of a SWIFFT operation on a short input.
+//! The result is the same as for the input padded with zeros to 256 bytes.
+//!
+//! \param[in] input the input of 64 bytes (512 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_Compute64(const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE_64],
+	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_Compute64)(input, output);
+}
+
+//! \brief Computes the result of a SWIFFT operation on a short input.
+//! The result is the same as for the input and sign bits padded with zeros to 256 bytes.
+//!
+//! \param[in] input the input of 64 bytes (512 bit).
+//! \param[in] sign the sign bits corresponding to the input of 64 bytes (512 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ComputeSigned64(const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE_64],
+	const BitSequence sign[SWIFFT_INPUT_BLOCK_SIZE_64],
+	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_ComputeSigned64)(input, sign, output);
+}
+
+//! \brief Computes the result of multiple SWIFFT operations on short inputs.
+//! The result is the same as for the inputs padded with zeros to 256 bytes.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] input the blocks of input, each of 64 bytes (512 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void SWIFFT_ComputeMultiple64(int nblocks, const BitSequence * input, BitSequence * output)
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_ComputeMultiple64)(nblocks, input, output);
+}
+
+//! \brief Computes the result of multiple SWIFFT operations on short inputs.
+//! The result is the same as for the inputs and sign bits padded with zeros to 256 bytes.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] input the blocks of input, each of 64 bytes (512 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 64 bytes (512 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void SWIFFT_ComputeMultipleSigned64(int nblocks, const BitSequence * input,
+	const BitSequence * sign, BitSequence * output)
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_ComputeMultipleSigned64)(nblocks, input, sign, output);
+}
+
+//! \brief Computes the result of a SWIFFT operation on a short input with a given key.
+//! The result is the same as of SWIFFT_ComputeKeyed for the input padded with zeros to 256 bytes.
+//!
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the input of 128 bytes (1024 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_Compute128Keyed(const swifft_key_t * key, const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE_128],
+	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_Compute128Keyed)(key, input, output);
+}
+
+//! \brief Computes the result of a SWIFFT operation on a short input with a given key.
+//! The result is the same as of SWIFFT_ComputeSignedKeyed for the input padded with zeros to 256 bytes.
+//!
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the input of 128 bytes (1024 bit).
+//! \param[in] sign the sign bits corresponding to the input of 128 bytes (1024 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ComputeSigned128Keyed(const swifft_key_t * key, const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE_128],
+	const BitSequence sign[SWIFFT_INPUT_BLOCK_SIZE_128], BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_ComputeSigned128Keyed)(key, input, sign, output);
+}
+
+//! \brief Computes the result of multiple SWIFFT operations on short inputs with a given key.
+//! The result is the same as of SWIFFT_ComputeMultipleKeyed for the inputs padded with zeros to 256 bytes.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the blocks of input, each of 128 bytes (1024 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void SWIFFT_ComputeMultiple128Keyed(int nblocks, const swifft_key_t * key, const BitSequence * input,
+	BitSequence * output)
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_ComputeMultiple128Keyed)(nblocks, key, input, output);
+}
+
+//! \brief Computes the result of multiple SWIFFT operations on short inputs with a given key.
+//! The result is the same as of SWIFFT_ComputeMultipleSignedKeyed for the inputs padded with zeros to 256 bytes.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the blocks of input, each of 128 bytes (1024 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 128 bytes (1024 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void SWIFFT_ComputeMultipleSigned128Keyed(int nblocks, const swifft_key_t * key, const BitSequence * input,
+	const BitSequence * sign, BitSequence * output)
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_ComputeMultipleSigned128Keyed)(nblocks, key, input, sign, output);
+}
+
+//! \brief Computes the result of a SWIFFT operation on a short input with a given key.
+//! The result is the same as of SWIFFT_ComputeKeyed for the input padded with zeros to 256 bytes.
+//!
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the input of 64 bytes (512 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_Compute64Keyed(const swifft_key_t * key, const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE_64],
+	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_Compute64Keyed)(key, input, output);
+}
+
+//! \brief Computes the result of a SWIFFT operation on a short input with a given key.
+//! The result is the same as of SWIFFT_ComputeSignedKeyed for the input padded with zeros to 256 bytes.
+//!
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the input of 64 bytes (512 bit).
+//! \param[in] sign the sign bits corresponding to the input of 64 bytes (512 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ComputeSigned64Keyed(const swifft_key_t * key, const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE_64],
+	const BitSequence sign[SWIFFT_INPUT_BLOCK_SIZE_64], BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_ComputeSigned64Keyed)(key, input, sign, output);
+}
+
+//! \brief Computes the result of multiple SWIFFT operations on short inputs with a given key.
+//! The result is the same as of SWIFFT_ComputeMultipleKeyed for the inputs padded with zeros to 256 bytes.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the blocks of input, each of 64 bytes (512 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void SWIFFT_ComputeMultiple64Keyed(int nblocks, const swifft_key_t * key, const BitSequence * input,
+	BitSequence * output)
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_ComputeMultiple64Keyed)(nblocks, key, input, output);
+}
+
+//! \brief Computes the result of multiple SWIFFT operations on short inputs with a given key.
+//! The result is the same as of SWIFFT_ComputeMultipleSignedKeyed for the inputs padded with zeros to 256 bytes.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the blocks of input, each of 64 bytes (512 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 64 bytes (512 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void SWIFFT_ComputeMultipleSigned64Keyed(int nblocks, const swifft_key_t * key, const BitSequence * input,
+	const BitSequence * sign, BitSequence * output)
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_ComputeMultipleSigned64Keyed)(nblocks, key, input, sign, output);
+}
+
+//! \brief Computes the sum of the results of SWIFFT operations for multiple blocks.
+//! The result is the same as summing the results of SWIFFT_ComputeMultiple, but faster.
+//!
+//! \param[in] nblocks the number of blocks to sum.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ComputeSum(int nblocks, const BitSequence * input,
+	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_ComputeSum)(nblocks, input, output);
+}
+
+//! \brief Computes the sum of the results of SWIFFT operations for multiple blocks.
+//! The result is the same as summing the results of SWIFFT_ComputeMultipleSigned, but faster.
+//!
+//! \param[in] nblocks the number of blocks to sum.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ComputeSumSigned(int nblocks, const BitSequence * input,
+	const BitSequence * sign, BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_ComputeSumSigned)(nblocks, input, sign, output);
+}
+
+//! \brief Computes a linear combination of the results of SWIFFT operations for multiple blocks.
+//! The result is the same as SWIFFT_LinearCombination of the results of SWIFFT_ComputeMultiple, but faster.
+//!
+//! \param[in] nblocks the number of blocks to combine.
+//! \param[in] coeffs the coefficients of the blocks.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ComputeLinearCombination(int nblocks, const int16_t * coeffs,
+	const BitSequence * input, BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_ComputeLinearCombination)(nblocks, coeffs, input, output);
+}
+
+//! \brief Computes a linear combination of the results of SWIFFT operations for multiple blocks.
+//! The result is the same as SWIFFT_LinearCombination of the results of SWIFFT_ComputeMultipleSigned, but faster.
+//!
+//! \param[in] nblocks the number of blocks to combine.
+//! \param[in] coeffs the coefficients of the blocks.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ComputeLinearCombinationSigned(int nblocks, const int16_t * coeffs,
+	const BitSequence * input, const BitSequence * sign, BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_ComputeLinearCombinationSigned)(nblocks, coeffs, input, sign, output);
+}
+
+//! \brief Computes the sum of the results of SWIFFT operations with a given key for multiple blocks.
+//! The result is the same as summing the results of SWIFFT_ComputeMultipleKeyed, but faster.
+//!
+//! \param[in] nblocks the number of blocks to sum.
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ComputeSumKeyed(int nblocks, const swifft_key_t * key, const BitSequence * input,
+	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_ComputeSumKeyed)(nblocks, key, input, output);
+}
+
+//! \brief Computes the sum of the results of SWIFFT operations with a given key for multiple blocks.
+//! The result is the same as summing the results of SWIFFT_ComputeMultipleSignedKeyed, but faster.
+//!
+//! \param[in] nblocks the number of blocks to sum.
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ComputeSumSignedKeyed(int nblocks, const swifft_key_t * key, const BitSequence * input,
+	const BitSequence * sign, BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_ComputeSumSignedKeyed)(nblocks, key, input, sign, output);
+}
+
+//! \brief Computes a linear combination of the results of SWIFFT operations with a given key for multiple blocks.
+//! The result is the same as SWIFFT_LinearCombination of the results of SWIFFT_ComputeMultipleKeyed, but faster.
+//!
+//! \param[in] nblocks the number of blocks to combine.
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] coeffs the coefficients of the blocks.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ComputeLinearCombinationKeyed(int nblocks, const swifft_key_t * key, const int16_t * coeffs,
+	const BitSequence * input, BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_ComputeLinearCombinationKeyed)(nblocks, key, coeffs, input, output);
+}
+
+//! \brief Computes a linear combination of the results of SWIFFT operations with a given key for multiple blocks.
+//! The result is the same as SWIFFT_LinearCombination of the results of SWIFFT_ComputeMultipleSignedKeyed, but faster.
+//!
+//! \param[in] nblocks the number of blocks to combine.
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] coeffs the coefficients of the blocks.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ComputeLinearCombinationSignedKeyed(int nblocks, const swifft_key_t * key, const int16_t * coeffs,
+	const BitSequence * input, const BitSequence * sign, BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_ComputeLinearCombinationSignedKeyed)(nblocks, key, coeffs, input, sign, output);
+}
+
+//! \brief Updates the result of a SWIFFT operation for a change of some input bits.
+//! The result is the same as computing SWIFFT_Compute of the new input, in time proportional to the number of positions.
+//!
+//! \param[in,out] output the hash value of SWIFFT of the old input, of size 128 bytes (1024 bit), to update to that of the new input.
+//! \param[in] npositions the number of positions of input bits to update.
+//! \param[in] positions the distinct positions of the input bits that may have changed, each in {0,..,2047} for bit p&7 of byte p>>3.
+//! \param[in] oldInput the old input of 256 bytes (2048 bit).
+//! \param[in] newInput the new input of 256 bytes (2048 bit).
+void SWIFFT_UpdateBits(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
+	int npositions, const int * positions, const BitSequence * oldInput, const BitSequence * newInput)
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_UpdateBits)(output, npositions, positions, oldInput, newInput);
+}
+
+//! \brief Updates the result of a SWIFFT operation for a change of some input bits or their sign bits.
+//! The result is the same as computing SWIFFT_ComputeSigned of the new input, in time proportional to the number of positions.
+//!
+//! \param[in,out] output the hash value of SWIFFT of the old input, of size 128 bytes (1024 bit), to update to that of the new input.
+//! \param[in] npositions the number of positions of input bits to update.
+//! \param[in] positions the distinct positions of the input bits that may have changed, each in {0,..,2047} for bit p&7 of byte p>>3.
+//! \param[in] oldInput the old input of 256 bytes (2048 bit).
+//! \param[in] oldSign the sign bits corresponding to the old input of 256 bytes (2048 bit).
+//! \param[in] newInput the new input of 256 bytes (2048 bit).
+//! \param[in] newSign the sign bits corresponding to the new input of 256 bytes (2048 bit).
+void SWIFFT_UpdateBitsSigned(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
+	int npositions, const int * positions, const BitSequence * oldInput, const BitSequence * oldSign,
+	const BitSequence * newInput, const BitSequence * newSign)
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_UpdateBitsSigned)(output, npositions, positions, oldInput, oldSign, newInput, newSign);
+}
+
+//! \brief Updates the results of multiple SWIFFT operations for a change of some input bits.
+//! The result is the same as computing SWIFFT_ComputeMultiple of the new inputs, in time proportional to the number of positions.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the blocks of hash values of SWIFFT of the old inputs, each of size 128 bytes (1024 bit), to update to those of the new inputs.
+//! \param[in] npositions the number of positions of input bits to update in each block.
+//! \param[in] positions the distinct positions of the input bits that may have changed in each block, each in {0,..,2047} for bit p&7 of byte p>>3.
+//! \param[in] oldInput the blocks of old input, each of 256 bytes (2048 bit).
+//! \param[in] newInput the blocks of new input, each of 256 bytes (2048 bit).
+void SWIFFT_UpdateBitsMultiple(int nblocks, BitSequence * output,
+	int npositions, const int * positions, const BitSequence * oldInput, const BitSequence * newInput)
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_UpdateBitsMultiple)(nblocks, output, npositions, positions, oldInput, newInput);
+}
+
+//! \brief Updates the results of multiple SWIFFT operations for a change of some input bits or their sign bits.
+//! The result is the same as computing SWIFFT_ComputeMultipleSigned of the new inputs, in time proportional to the number of positions.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the blocks of hash values of SWIFFT of the old inputs, each of size 128 bytes (1024 bit), to update to those of the new inputs.
+//! \param[in] npositions the number of positions of input bits to update in each block.
+//! \param[in] positions the distinct positions of the input bits that may have changed in each block, each in {0,..,2047} for bit p&7 of byte p>>3.
+//! \param[in] oldInput the blocks of old input, each of 256 bytes (2048 bit).
+//! \param[in] oldSign the blocks of sign bits corresponding to blocks of old input of 256 bytes (2048 bit).
+//! \param[in] newInput the blocks of new input, each of 256 bytes (2048 bit).
+//! \param[in] newSign the blocks of sign bits corresponding to blocks of new input of 256 bytes (2048 bit).
+void SWIFFT_UpdateBitsMultipleSigned(int nblocks, BitSequence * output,
+	int npositions, const int * positions, const BitSequence * oldInput, const BitSequence * oldSign,
+	const BitSequence * newInput, const BitSequence * newSign)
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_UpdateBitsMultipleSigned)(nblocks, output, npositions, positions, oldInput, oldSign, newInput, newSign);
+}
+
+//! \brief Computes the result of a SWIFFT operation on a sparse input, given by the positions of its nonzero bits.
+//! The result is the same as for SWIFFT_Compute, in time proportional to the number of nonzero bits when they are few.
+//!
+//! \param[in] count the number of nonzero input bits.
+//! \param[in] indices the distinct positions of the nonzero input bits, each in {0,..,2047} for bit p&7 of byte p>>3.
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ComputeSparse(int count, const int * indices, BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_ComputeSparse)(count, indices, output);
+}
+
+//! \brief Computes the result of a SWIFFT operation on a sparse input, given by the positions and signs of its nonzero bits.
+//! The result is the same as for SWIFFT_ComputeSigned, in time proportional to the number of nonzero bits when they are few.
+//!
+//! \param[in] count the number of nonzero input bits.
+//! \param[in] indices the distinct positions of the nonzero input bits, each in {0,..,2047} for bit p&7 of byte p>>3.
+//! \param[in] sign the signs of the nonzero input bits, each 1 for negative or 0 for positive.
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ComputeSparseSigned(int count, const int * indices, const BitSequence * sign,
+	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_ComputeSparseSigned)(count, indices, sign, output);
+}
+
+//! \brief Computes the results of multiple SWIFFT operations on sparse inputs, given by the positions of their nonzero bits.
+//! The result is the same as for SWIFFT_ComputeMultiple, in time proportional to the number of nonzero bits when they are few.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] offsets the nblocks+1 offsets in indices where the nonzero input bits of each block start, followed by their total number.
+//! \param[in] indices the distinct positions of the nonzero input bits of each block, each in {0,..,2047} for bit p&7 of byte p>>3.
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void SWIFFT_ComputeSparseMultiple(int nblocks, const int * offsets, const int * indices,
+	BitSequence * output)
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_ComputeSparseMultiple)(nblocks, offsets, indices, output);
+}
+
+//! \brief Computes the results of multiple SWIFFT operations on sparse inputs, given by the positions and signs of their nonzero bits.
+//! The result is the same as for SWIFFT_ComputeMultipleSigned, in time proportional to the number of nonzero bits when they are few.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] offsets the nblocks+1 offsets in indices where the nonzero input bits of each block start, followed by their total number.
+//! \param[in] indices the distinct positions of the nonzero input bits of each block, each in {0,..,2047} for bit p&7 of byte p>>3.
+//! \param[in] sign the signs of the nonzero input bits, each 1 for negative or 0 for positive.
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void SWIFFT_ComputeSparseMultipleSigned(int nblocks, const int * offsets, const int * indices,
+	const BitSequence * sign, BitSequence * output)
+{
+	SWIFFT_DISPATCH(hash.SWIFFT_ComputeSparseMultipleSigned)(nblocks, offsets, indices, sign, output);
 }
 
 LIBSWIFFT_END_EXTERN_C
@@ -17,86 +17,293 @@
 
 LIBSWIFFT_BEGIN_EXTERN_C
 
-//! \brief Computes the FFT phase of SWIFFT.
+#define SWIFFT_LOOKUP_UNSIGNED 0     ///< Looks up the FFT table for input without sign, in its unsigned part
+#define SWIFFT_LOOKUP_SIGNED 1       ///< Looks up the FFT table for input with sign, in its unsigned part twice
+#define SWIFFT_LOOKUP_SIGNED_TABLE 2 ///< Looks up the FFT table for input with sign, in the whole of it
+
+#define SWIFFT_MAX_INTERLEAVE 8      ///< Maximum number of blocks to compute in interleaved fashion
+
+#ifndef SWIFFT_INTERLEAVE
+	//! Number of blocks to compute in interleaved fashion in multiple-block operations, one of 1, 2, 4, or 8
+	#define SWIFFT_INTERLEAVE 4
+#endif
+
+#ifndef SWIFFT_SIGNED_LOOKUP
+	//! The mode of looking up the FFT table for input with sign
+	#define SWIFFT_SIGNED_LOOKUP SWIFFT_LOOKUP_SIGNED
+#endif
+
+//! The built-in SWIFFT key, in the layout for SWIFFT_O
+#define SWIFFT_KEY_O (SWIFFT_PI_keyO + SWIFFT_LOG2_O*SWIFFT_M*SWIFFT_N)
+//! A SWIFFT key of type swifft_key_t, in the layout for SWIFFT_O
+#define SWIFFT_KEY_LAYOUT_O(key) ((key)->layouts + SWIFFT_LOG2_O*SWIFFT_KEY_SIZE)
+
+//! \brief Looks up the FFT table for SWIFFT_O input bytes with their sign bytes.
+//! The FFT table entry for input bits t with sign bits u is the difference of the entries
+//! for the unsigned input bits t&~u and t&u, so SWIFFT_LOOKUP_SIGNED touches only the
+//! first SWIFFT_V entries, or 4KB, of the FFT table instead of all of its 1MB.
+//!
+//! \param[in] Tabl the FFT table.
+//! \param[in] t the input bytes, used at a stride of 8.
+//! \param[in] u the sign bytes, used at a stride of 8.
+//! \param[in] mode the lookup mode, one of SWIFFT_LOOKUP_*.
+//! \returns the wide SWIFFT vector of FFT table entries, in the range {-128,..,128}.
+static inline ZOvec SWIFFT_lookup(const Z1vec *Tabl, const BitSequence *t, const BitSequence *u, int mode)
+{
+	int j, idx[SWIFFT_O], idx2[SWIFFT_O];
+	if (mode == SWIFFT_LOOKUP_SIGNED) {
+		for (j=0; j<SWIFFT_O; j++) {
+			idx[j] = t[8*j] & ~u[8*j];
+			idx2[j] = t[8*j] & u[8*j];
+		}
+		return SWIFFT_centerP(SWIFFT_gatherDiffO(Tabl, idx, idx2));
+	}
+	for (j=0; j<SWIFFT_O; j++) {
+		idx[j] = (mode == SWIFFT_LOOKUP_UNSIGNED) ? t[8*j] : SWIFFT_INT16(u[8*j],t[8*j]);
+	}
+	return SWIFFT_gatherO(Tabl, idx);
+}
+
+//! \brief Computes the FFT of SWIFFT_O 8-elements of input, each in its own part of the wide SWIFFT vectors.
+//!
+//! \param[in] Tabl the FFT table.
+//! \param[in] t the input bytes of the SWIFFT_O 8-elements.
+//! \param[in] u the sign bytes of the SWIFFT_O 8-elements.
+//! \param[in] mode the lookup mode, one of SWIFFT_LOOKUP_*.
+//! \param[out] v the 8 wide SWIFFT vectors of FFT-output elements.
+static inline void SWIFFT_fftO(const Z1vec *Tabl, const BitSequence *t, const BitSequence *u, int mode, ZOvec v[8])
+{
+	int k;
+	const ZOvec *Mult = (const ZOvec *) SWIFFT_multipliersO;
+
+	// no need for SWIFFT_safeMult because multipliers do not hit an edge case
+	v[0] = SWIFFT_lookup(Tabl, t, u, mode);
+	for (k=1; k<8; k++) {
+		v[k] = SWIFFT_lookup(Tabl, t+k, u+k, mode) * Mult[k << (SWIFFT_MAX_LOG2_O - SWIFFT_LOG2_O)];
+	}
+
+	SWIFFT_AddSub(v[0],v[1]);
+	SWIFFT_AddSub(v[2],v[3]);
+	SWIFFT_AddSub(v[4],v[5]);
+	SWIFFT_AddSub(v[6],v[7]);
+
+	v[2] = SWIFFT_qReduce(v[2]);
+	v[3] = SWIFFT_shift(v[3],4);
+	v[6] = SWIFFT_qReduce(v[6]);
+	v[7] = SWIFFT_shift(v[7],4);
+
+	SWIFFT_AddSub(v[0],v[2]);
+	SWIFFT_AddSub(v[1],v[3]);
+	SWIFFT_AddSub(v[4],v[6]);
+	SWIFFT_AddSub(v[5],v[7]);
+
+	v[4] = SWIFFT_qReduce(v[4]);
+	v[5] = SWIFFT_shift(v[5],2);
+	v[6] = SWIFFT_shift(v[6],4);
+	v[7] = SWIFFT_shift(v[7],6);
+
+	SWIFFT_AddSub(v[0],v[4]);
+	SWIFFT_AddSub(v[1],v[5]);
+	SWIFFT_AddSub(v[2],v[6]);
+	SWIFFT_AddSub(v[3],v[7]);
+
+	for (k=0; k<8; k++) {
+		v[k] = SWIFFT_qReduce(v[k]);
+	}
+}
+
+//! \brief Computes the FFT phase of SWIFFT using a given mode of looking up the FFT table.
 //!
 //! \param[in] input the blocks of input, each of 256 bytes (2048 bits).
 //! \param[in] sign the blocks of sign bits corresponding to blocks of input of 256 bytes (2048 bits).
 //! \param[in] m number of 8-elements in the input.
 //! \param[out] fftout the blocks of FFT-output elements, totaling SWIFFT_N*m.
-void SWIFFT_ISET_NAME(SWIFFT_fft_)(const BitSequence * LIBSWIFFT_RESTRICT input, const BitSequence * LIBSWIFFT_RESTRICT sign, int m, int16_t * LIBSWIFFT_RESTRICT fftout)
+//! \param[in] mode the lookup mode, one of SWIFFT_LOOKUP_*.
+static inline void SWIFFT_fftWithLookup(const BitSequence * LIBSWIFFT_RESTRICT input, const BitSequence * LIBSWIFFT_RESTRICT sign, int m, int16_t * LIBSWIFFT_RESTRICT fftout, int mode)
 {
-	int i,j,k;
+	int i;
 	Z1vec *out = (Z1vec *) fftout;
-	const Z1vec *Mult = (const Z1vec *) SWIFFT_multipliers;
 	const Z1vec *Tabl = (const Z1vec *) SWIFFT_fftTable;
 
 	const BitSequence *t = input;
 	const BitSequence *u = sign;
 	ZOvec v[8];
 
-	for (i=0; i<(m>>SWIFFT_LOG2_O); i++) {
-		for (j=0; j<SWIFFT_O; j++,t+=8,u+=8) {
-			// no need for SWIFFT_safeMult because multipliers do not hit an edge case
-			((Z1vec *)&v[0])[j] = Tabl[SWIFFT_INT16(u[0],t[0])];
-			for (k=1; k<8; k++) {
-				((Z1vec *)&v[k])[j] = Tabl[SWIFFT_INT16(u[k],t[k])] * Mult[k];
-			}
-		}
-
-		SWIFFT_AddSub(v[0],v[1]);
-		SWIFFT_AddSub(v[2],v[3]);
-		SWIFFT_AddSub(v[4],v[5]);
-		SWIFFT_AddSub(v[6],v[7]);
+	for (i=0; i<(m>>SWIFFT_LOG2_O); i++,t+=8*SWIFFT_O,u+=8*SWIFFT_O,out+=8*SWIFFT_O) {
+		SWIFFT_fftO(Tabl, t, u, mode, v);
+		SWIFFT_storeTransposedO(v, out);
+	}
+}
 
-		v[2] = SWIFFT_qReduce(v[2]);
-		v[3] = SWIFFT_shift(v[3],4);
-		v[6] = SWIFFT_qReduce(v[6]);
-		v[7] = SWIFFT_shift(v[7],4);
+//! \brief Stores the output elements of a block summed over 8-elements in the parts of wide SWIFFT vectors.
+//!
+//! \param[in] dacc the 32-bit sums of products of FFT-output elements and the key, per 8-element.
+//! \param[out] iout the block of output elements, of 64 double-bytes (1024 bits).
+static inline void SWIFFT_storeSumO(ZOdvec dacc[][2], int16_t * LIBSWIFFT_RESTRICT iout)
+{
+	int j,k;
+	ZOvec acc[8];
+	SWIFFT_ALIGN Z1vec accT[8*SWIFFT_O];
+	ZOvec *out = (ZOvec *)iout;
 
-		SWIFFT_AddSub(v[0],v[2]);
-		SWIFFT_AddSub(v[1],v[3]);
-		SWIFFT_AddSub(v[4],v[6]);
-		SWIFFT_AddSub(v[5],v[7]);
+	for (k=0; k<8; k++) {
+		acc[k] = SWIFFT_packReduce(dacc[k]);
+	}
+	// each part of the accumulators has summed over different 8-elements of input
+	SWIFFT_storeTransposedO(acc, accT);
+	const ZOvec *zaccT = (const ZOvec *)accT;
+	for (j=0; j<(8>>SWIFFT_LOG2_O); j++) {
+		ZOvec sum = zaccT[j];
+		for (k=1; k<SWIFFT_O; k++) {
+			sum += zaccT[k*(8>>SWIFFT_LOG2_O)+j];
+		}
+		out[j] = SWIFFT_modP(sum);
+	}
+}
 
-		v[4] = SWIFFT_qReduce(v[4]);
-		v[5] = SWIFFT_shift(v[5],2);
-		v[6] = SWIFFT_shift(v[6],4);
-		v[7] = SWIFFT_shift(v[7],6);
+//! \brief Computes the FFT and FFT-sum phases of SWIFFT together for interleaved blocks, using a given mode of looking up the FFT table.
+//! Each FFT-output element is multiplied by the key and accumulated as soon as it is computed,
+//! rather than stored and loaded back, into 32-bit sums that are reduced once. Each key vector is loaded once for all blocks, and the
+//! independent table lookups of the blocks may overlap.
+//!
+//! \param[in] nb the number of blocks to interleave, a compile-time constant of at most SWIFFT_MAX_INTERLEAVE.
+//! \param[in] input the blocks of input, each of 8*m bytes.
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 8*m bytes.
+//! \param[in] signStride the distance in bytes between blocks of sign bits, 0 for the same sign bits for all blocks.
+//! \param[in] m number of 8-elements in each block of input.
+//! \param[in] ikey the SWIFFT key, in the layout for SWIFFT_O (see SWIFFT_PI_keyO).
+//! \param[out] iout the blocks of output elements, each of 64 double-bytes (1024 bits).
+//! \param[in] mode the lookup mode, one of SWIFFT_LOOKUP_*.
+static inline void SWIFFT_fftsumWithLookup(int nb, const BitSequence * LIBSWIFFT_RESTRICT input, const BitSequence * LIBSWIFFT_RESTRICT sign,
+	size_t signStride, int m, const int16_t * LIBSWIFFT_RESTRICT ikey, int16_t * LIBSWIFFT_RESTRICT iout, int mode)
+{
+	int i,k,b;
+	const Z1vec *Tabl = (const Z1vec *) SWIFFT_fftTable;
+	const ZOvec *key = (const ZOvec *)ikey;
 
-		SWIFFT_AddSub(v[0],v[4]);
-		SWIFFT_AddSub(v[1],v[5]);
-		SWIFFT_AddSub(v[2],v[6]);
-		SWIFFT_AddSub(v[3],v[7]);
+	const BitSequence *t = input;
+	const BitSequence *u = sign;
+	ZOvec v[nb][2][8];
+	ZOdvec dacc[nb][8][2];
+	ZOvec zero = {0};
 
+	for (b=0; b<nb; b++) {
 		for (k=0; k<8; k++) {
-			v[k] = SWIFFT_qReduce(v[k]);
+			dacc[b][k][0] = dacc[b][k][1] = (ZOdvec){0};
 		}
-
-		for (j=0; j<SWIFFT_O; j++,out+=8) {
+	}
+	// multiplying and adding pairs of FFT-outputs of consecutive groups of SWIFFT_O 8-elements
+	for (i=0; i+1<(m>>SWIFFT_LOG2_O); i+=2,t+=16*SWIFFT_O,u+=16*SWIFFT_O,key+=16) {
+		for (b=0; b<nb; b++) {
+			SWIFFT_fftO(Tabl, t + b*8*m, u + b*signStride, mode, v[b][0]);
+			SWIFFT_fftO(Tabl, t + 8*SWIFFT_O + b*8*m, u + 8*SWIFFT_O + b*signStride, mode, v[b][1]);
+		}
+		for (k=0; k<8; k++) {
+			for (b=0; b<nb; b++) {
+				SWIFFT_maddPairO(dacc[b][k], v[b][0][k], v[b][1][k], key[k], key[8+k]);
+			}
+		}
+	}
+	if (i<(m>>SWIFFT_LOG2_O)) {
+		for (b=0; b<nb; b++) {
+			SWIFFT_fftO(Tabl, t + b*8*m, u + b*signStride, mode, v[b][0]);
 			for (k=0; k<8; k++) {
-				out[k] = ((Z1vec *)&v[k])[j];
+				SWIFFT_maddPairO(dacc[b][k], v[b][0][k], zero, key[k], zero);
 			}
 		}
 	}
+	for (b=0; b<nb; b++) {
+		SWIFFT_storeSumO(dacc[b], iout + b*(SWIFFT_OUTPUT_BLOCK_SIZE/sizeof(int16_t)));
+	}
 }
 
-void SWIFFT_ISET_NAME(SWIFFT_fftsum_)(const int16_t * LIBSWIFFT_RESTRICT ikey,
+//! \brief Computes the FFT phase of SWIFFT, looking up the FFT table in the mode for the sign.
+//!
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bits).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 256 bytes (2048 bits).
+//! \param[in] m number of 8-elements in the input.
+//! \param[out] fftout the blocks of FFT-output elements, totaling SWIFFT_N*m.
+static inline void SWIFFT_fftWithSign(const BitSequence * LIBSWIFFT_RESTRICT input, const BitSequence * LIBSWIFFT_RESTRICT sign, int m, int16_t * LIBSWIFFT_RESTRICT fftout)
+{
+	if (sign == SWIFFT_sign0) {
+		SWIFFT_fftWithLookup(input, sign, m, fftout, SWIFFT_LOOKUP_UNSIGNED);
+	} else {
+		SWIFFT_fftWithLookup(input, sign, m, fftout, SWIFFT_SIGNED_LOOKUP);
+	}
+}
+
+//! \brief Computes the FFT phase of SWIFFT.
+//!
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bits).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 256 bytes (2048 bits).
+//! \param[in] m number of 8-elements in the input.
+//! \param[out] fftout the blocks of FFT-output elements, totaling SWIFFT_N*m.
+void SWIFFT_ISET_NAME(SWIFFT_fft_)(const BitSequence * LIBSWIFFT_RESTRICT input, const BitSequence * LIBSWIFFT_RESTRICT sign, int m, int16_t * LIBSWIFFT_RESTRICT fftout)
+{
+	// instantiating the kernel with a constant number of 8-elements for the common input lengths
+	switch (m) {
+	case SWIFFT_M:
+		SWIFFT_fftWithSign(input, sign, SWIFFT_M, fftout);
+		break;
+	case SWIFFT_M/2:
+		SWIFFT_fftWithSign(input, sign, SWIFFT_M/2, fftout);
+		break;
+	default:
+		SWIFFT_fftWithSign(input, sign, m, fftout);
+		break;
+	}
+}
+
+//! \brief Computes the FFT-sum phase of SWIFFT.
+//!
+//! \param[in] ikey the SWIFFT key.
+//! \param[in] ifftout the blocks of FFT-output elements, totaling N*m
+//! \param[in] m number of 8-elements in the input.
+//! \param[out] iout the blocks of output elements, each of 64 double-bytes (1024 bits).
+static inline void SWIFFT_fftsumWithM(const int16_t * LIBSWIFFT_RESTRICT ikey,
 	const int16_t * LIBSWIFFT_RESTRICT ifftout, int m, int16_t * LIBSWIFFT_RESTRICT iout)
 {
 	int i,j;
 	const ZOvec *key = (const ZOvec *)ikey;
 	const ZOvec *fftout = (const ZOvec *)ifftout;
 	ZOvec *out = (ZOvec *)iout;
+	ZOvec zero = {0};
 
-	ZOvec v[8 >> SWIFFT_LOG2_O] = {0};
-	for (i=0; i<m; i++,fftout+=(8>>SWIFFT_LOG2_O),key+=(8>>SWIFFT_LOG2_O)) {
+	// accumulating 32-bit sums of products without reducing, which cannot overflow for up to
+	// 2^9 8-elements (each product is at most 2^15*2^7), and reducing once at the end
+	ZOdvec v[8 >> SWIFFT_LOG2_O][2];
+	for (j=0; j<(8>>SWIFFT_LOG2_O); j++) {
+		v[j][0] = v[j][1] = (ZOdvec){0};
+	}
+	for (i=0; i+1<m; i+=2,fftout+=2*(8>>SWIFFT_LOG2_O),key+=2*(8>>SWIFFT_LOG2_O)) {
+		for (j=0; j<(8>>SWIFFT_LOG2_O); j++) {
+			SWIFFT_maddPairO(v[j], fftout[j], fftout[j+(8>>SWIFFT_LOG2_O)], key[j], key[j+(8>>SWIFFT_LOG2_O)]);
+		}
+	}
+	if (i<m) {
 		for (j=0; j<(8>>SWIFFT_LOG2_O); j++) {
-			// reducing fftout to avoid overflow
-			v[j] += SWIFFT_qReduce(SWIFFT_safeMult((fftout[j]), key[j]));
+			SWIFFT_maddPairO(v[j], fftout[j], zero, key[j], zero);
 		}
 	}
 	for (j=0; j<(8>>SWIFFT_LOG2_O); j++) {
-		out[j] = SWIFFT_modP(v[j]);
+		out[j] = SWIFFT_modP(SWIFFT_packReduce(v[j]));
+	}
+}
+
+void SWIFFT_ISET_NAME(SWIFFT_fftsum_)(const int16_t * LIBSWIFFT_RESTRICT ikey,
+	const int16_t * LIBSWIFFT_RESTRICT ifftout, int m, int16_t * LIBSWIFFT_RESTRICT iout)
+{
+	// instantiating the kernel with a constant number of 8-elements for the common input lengths
+	switch (m) {
+	case SWIFFT_M:
+		SWIFFT_fftsumWithM(ikey, ifftout, SWIFFT_M, iout);
+		break;
+	case SWIFFT_M/2:
+		SWIFFT_fftsumWithM(ikey, ifftout, SWIFFT_M/2, iout);
+		break;
+	default:
+		SWIFFT_fftsumWithM(ikey, ifftout, m, iout);
+		break;
 	}
 }
 
@@ -157,11 +364,12 @@ void SWIFFT_ISET_NAME(SWIFFT_ConstMul_)(BitSequence output[SWIFFT_OUTPUT_BLOCK_S
 	const int16_t operand)
 {
 	size_t i;
-	const ZOvec zoperand = ZOCONST(operand);
+	// products of centered elements are in {-128*128,..,128*128} so do not overflow
+	const ZOvec zoperand = SWIFFT_centerP(SWIFFT_modP((ZOvec)ZOCONST(operand)));
 	ZOvec *zoutput = (ZOvec *)output;
 	size_t size = SWIFFT_OUTPUT_BLOCK_SIZE/sizeof(ZOvec);
 	for (i=0; i<size; i++,zoutput++) {
-		*zoutput = SWIFFT_modP(*zoutput * zoperand);
+		*zoutput = SWIFFT_modP(SWIFFT_centerP(*zoutput) * zoperand);
 	}
 }
 
@@ -219,7 +427,106 @@ void SWIFFT_ISET_NAME(SWIFFT_Mul_)(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
 	ZOvec *zoutput = (ZOvec *)output;
 	size_t size = SWIFFT_OUTPUT_BLOCK_SIZE/sizeof(ZOvec);
 	for (i=0; i<size; i++,zoperand++,zoutput++) {
-		*zoutput = SWIFFT_modP(*zoutput * *zoperand);
+		// products of centered elements are in {-128*128,..,128*128} so do not overflow
+		*zoutput = SWIFFT_modP(SWIFFT_centerP(*zoutput) * SWIFFT_centerP(*zoperand));
+	}
+}
+
+//! \brief Adds the product of two SWIFFT hash values to another, element-wise.
+//!
+//! \param[in,out] output the hash value of SWIFFT to modify.
+//! \param[in] operand1 the first hash value to multiply.
+//! \param[in] operand2 the second hash value to multiply.
+void SWIFFT_ISET_NAME(SWIFFT_MulAdd_)(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
+	const BitSequence operand1[SWIFFT_OUTPUT_BLOCK_SIZE], const BitSequence operand2[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	size_t i;
+	const ZOvec *zoperand1 = (const ZOvec *)operand1;
+	const ZOvec *zoperand2 = (const ZOvec *)operand2;
+	ZOvec *zoutput = (ZOvec *)output;
+	size_t size = SWIFFT_OUTPUT_BLOCK_SIZE/sizeof(ZOvec);
+	for (i=0; i<size; i++,zoperand1++,zoperand2++,zoutput++) {
+		// sums in {-128*128,..,128*128+256} do not overflow so are reduced once
+		*zoutput = SWIFFT_modP(*zoutput + SWIFFT_centerP(*zoperand1) * SWIFFT_centerP(*zoperand2));
+	}
+}
+
+//! \brief Subtracts the product of two SWIFFT hash values from another, element-wise.
+//!
+//! \param[in,out] output the hash value of SWIFFT to modify.
+//! \param[in] operand1 the first hash value to multiply.
+//! \param[in] operand2 the second hash value to multiply.
+void SWIFFT_ISET_NAME(SWIFFT_MulSub_)(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
+	const BitSequence operand1[SWIFFT_OUTPUT_BLOCK_SIZE], const BitSequence operand2[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	size_t i;
+	const ZOvec *zoperand1 = (const ZOvec *)operand1;
+	const ZOvec *zoperand2 = (const ZOvec *)operand2;
+	ZOvec *zoutput = (ZOvec *)output;
+	size_t size = SWIFFT_OUTPUT_BLOCK_SIZE/sizeof(ZOvec);
+	for (i=0; i<size; i++,zoperand1++,zoperand2++,zoutput++) {
+		// differences in {-128*128,..,128*128+256} do not overflow so are reduced once
+		*zoutput = SWIFFT_modP(*zoutput - SWIFFT_centerP(*zoperand1) * SWIFFT_centerP(*zoperand2));
+	}
+}
+
+//! \brief Adds the product of a SWIFFT hash value and a constant value to another, element-wise.
+//!
+//! \param[in,out] output the hash value of SWIFFT to modify.
+//! \param[in] operand the hash value to multiply.
+//! \param[in] multiplier the constant value to multiply by.
+void SWIFFT_ISET_NAME(SWIFFT_ConstMulAdd_)(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
+	const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE], const int16_t multiplier)
+{
+	size_t i;
+	const ZOvec zmultiplier = SWIFFT_centerP(SWIFFT_modP((ZOvec)ZOCONST(multiplier)));
+	const ZOvec *zoperand = (const ZOvec *)operand;
+	ZOvec *zoutput = (ZOvec *)output;
+	size_t size = SWIFFT_OUTPUT_BLOCK_SIZE/sizeof(ZOvec);
+	for (i=0; i<size; i++,zoperand++,zoutput++) {
+		// sums in {-128*128,..,128*128+256} do not overflow so are reduced once
+		*zoutput = SWIFFT_modP(*zoutput + SWIFFT_centerP(*zoperand) * zmultiplier);
+	}
+}
+
+//! \brief Subtracts the product of a SWIFFT hash value and a constant value from another, element-wise.
+//!
+//! \param[in,out] output the hash value of SWIFFT to modify.
+//! \param[in] operand the hash value to multiply.
+//! \param[in] multiplier the constant value to multiply by.
+void SWIFFT_ISET_NAME(SWIFFT_ConstMulSub_)(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
+	const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE], const int16_t multiplier)
+{
+	size_t i;
+	const ZOvec zmultiplier = SWIFFT_centerP(SWIFFT_modP((ZOvec)ZOCONST(multiplier)));
+	const ZOvec *zoperand = (const ZOvec *)operand;
+	ZOvec *zoutput = (ZOvec *)output;
+	size_t size = SWIFFT_OUTPUT_BLOCK_SIZE/sizeof(ZOvec);
+	for (i=0; i<size; i++,zoperand++,zoutput++) {
+		// differences in {-128*128,..,128*128+256} do not overflow so are reduced once
+		*zoutput = SWIFFT_modP(*zoutput - SWIFFT_centerP(*zoperand) * zmultiplier);
+	}
+}
+
+//! \brief Computes the result of SWIFFT operations for interleaved blocks.
+//! The key for input shorter than 256 bytes is the prefix of the SWIFFT key, so the result is
+//! the same as for the input padded with zeros to 256 bytes.
+//!
+//! \param[in] nb the number of blocks to interleave, a compile-time constant of at most SWIFFT_MAX_INTERLEAVE.
+//! \param[in] m number of 8-elements in each block of input, a compile-time constant of at most SWIFFT_M.
+//! \param[in] input the blocks of input, each of 8*m bytes.
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 8*m bytes.
+//! \param[in] signStride the distance in bytes between blocks of sign bits, 0 for the same sign bits for all blocks.
+//! \param[in] key the SWIFFT key, in the layout for SWIFFT_O (see SWIFFT_PI_keyO).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+static inline void SWIFFT_computeBlocks(int nb, int m, const BitSequence * input, const BitSequence * sign,
+	size_t signStride, const int16_t * key, BitSequence * output)
+{
+	// do FFT and linear combination of FFT coefficients, fused
+	if (sign == SWIFFT_sign0) {
+		SWIFFT_fftsumWithLookup(nb, input, sign, signStride, m, key, (int16_t *)output, SWIFFT_LOOKUP_UNSIGNED);
+	} else {
+		SWIFFT_fftsumWithLookup(nb, input, sign, signStride, m, key, (int16_t *)output, SWIFFT_SIGNED_LOOKUP);
 	}
 }
 
@@ -228,15 +535,13 @@ void SWIFFT_ISET_NAME(SWIFFT_Mul_)(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
 //!
 //! \param[in] input the input of 256 bytes (2048 bit).
 //! \param[in] sign the sign bits corresponding to the input of 256 bytes (2048 bit).
+//! \param[in] key the SWIFFT key, in the layout for SWIFFT_O (see SWIFFT_PI_keyO).
 //! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
 static inline void SWIFFT_compute(const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE],
-	const BitSequence sign[SWIFFT_INPUT_BLOCK_SIZE],
+	const BitSequence sign[SWIFFT_INPUT_BLOCK_SIZE], const int16_t * key,
 	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
 {
-	// do FFT and linear combination of FFT coefficients
-	SWIFFT_ALIGN int16_t fftout[SWIFFT_N*SWIFFT_M];
-	SWIFFT_ISET_NAME(SWIFFT_fft_)(input, sign, SWIFFT_M, fftout);
-	SWIFFT_ISET_NAME(SWIFFT_fftsum_)(SWIFFT_PI_key, fftout, SWIFFT_M, (int16_t *)output);
+	SWIFFT_computeBlocks(1, SWIFFT_M, input, sign, 0, key, output);
 }
 
 //! \brief Computes the result of a SWIFFT operation.
@@ -247,7 +552,7 @@ static inline void SWIFFT_compute(const BitSequence input[SWIFFT_INPUT_BLOCK_SIZ
 void SWIFFT_ISET_NAME(SWIFFT_Compute_)(const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE],
 	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
 {
-	SWIFFT_compute(input, SWIFFT_sign0, output);
+	SWIFFT_compute(input, SWIFFT_sign0, SWIFFT_KEY_O, output);
 }
 
 //! \brief Computes the result of a SWIFFT operation.
@@ -260,7 +565,7 @@ void SWIFFT_ISET_NAME(SWIFFT_ComputeSigned_)(const BitSequence input[SWIFFT_INPU
 	const BitSequence sign[SWIFFT_INPUT_BLOCK_SIZE],
 	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
 {
-	SWIFFT_compute(input, sign, output);
+	SWIFFT_compute(input, sign, SWIFFT_KEY_O, output);
 }
 
 //! \brief Computes the FFT phase of SWIFFT for multiple blocks.
@@ -310,6 +615,101 @@ void SWIFFT_ISET_NAME(SWIFFT_fftsumMultiple_)(int nblocks, const int16_t * LIBSW
 	}
 }
 
+//! \brief Compacts a hash value of SWIFFT.
+//! Each 8 consecutive elements of the hash value are the base-257 digits, least significant first,
+//! of a number whose value modulo 2^64 is written as 8 base-256 digits, dropping its carry bit.
+//! The base conversion takes 3 steps, each merging pairs of adjacent digits into one digit of
+//! squared base, so no carry is ever propagated and no transposing is needed.
+//! Since 257^8 < 2^65, the dropped carry bits, one per number, make the compacted hash value lossless.
+//!
+//! \param[in] output the hash value of SWIFFT, of size 128 bytes (1024 bit).
+//! \param[out] compact the compacted hash value of SWIFFT, of size 64 bytes (512 bit).
+//! \param[out] carry the carry bits of the compacted hash value, the i-th for its i-th 8 bytes, or NULL to drop them.
+static inline void SWIFFT_compact(const BitSequence * LIBSWIFFT_RESTRICT output,
+	BitSequence * LIBSWIFFT_RESTRICT compact, BitSequence * LIBSWIFFT_RESTRICT carry)
+{
+	// native vectors are used, rather than wide SWIFFT vectors, since this is independent of SWIFFT_O
+	const ZVqvec ZQ_9 = ZVQCONST(9), ZQ_16 = ZVQCONST(16), ZQ_32 = ZVQCONST(32);
+	const ZVqvec ZQ_10 = ZVQCONST(10), ZQ_17 = ZVQCONST(17), ZQ_18 = ZVQCONST(18), ZQ_26 = ZVQCONST(26);
+	const ZVqvec evens = ZVQEVENS, odds = ZVQODDS;
+	const ZVdvec *in = (const ZVdvec *)output;
+	ZVqvec *out = (ZVqvec *)compact;
+	const int nlanes = (int)(sizeof(ZVqvec)/sizeof(uint64_t));
+	BitSequence carryBits = 0;
+	int i,j;
+	for (i=0; i<SWIFFT_COMPACT_BLOCK_SIZE/(int)sizeof(ZVqvec); i++) {
+		// pairs of base-257 digits to base-257^2 digits, then pairs of these to base-257^4 digits
+		ZVqvec q0 = SWIFFT_mergeDigits2V((ZVqvec)SWIFFT_mergeDigitsV(in[2*i]));
+		ZVqvec q1 = SWIFFT_mergeDigits2V((ZVqvec)SWIFFT_mergeDigitsV(in[2*i+1]));
+		// pairs of base-257^4 digits to numbers modulo 2^64: f0+f1*257^4, where 257^4=(2^16+2^9+1)^2
+		ZVqvec f0 = __builtin_shuffle(q0, q1, evens);
+		ZVqvec f1 = __builtin_shuffle(q0, q1, odds);
+		if (carry != NULL) {
+			// since 257^4 = 2^32+2^26+2^18+2^17+2^10+1, the carry bit is bit 32 of floor((f0+f1*(257^4-2^32))/2^32)+f1
+			ZVqvec low = f0 + (f1 << ZQ_26) + (f1 << ZQ_18) + (f1 << ZQ_17) + (f1 << ZQ_10) + f1;
+			ZVqvec c = ((low >> ZQ_32) + f1) >> ZQ_32;
+			for (j=0; j<nlanes; j++) {
+				carryBits |= (BitSequence)(c[j] << (i*nlanes + j));
+			}
+		}
+		f1 += (f1 << ZQ_16) + (f1 << ZQ_9);
+		f1 += (f1 << ZQ_16) + (f1 << ZQ_9);
+		out[i] = f0 + f1;
+	}
+	if (carry != NULL) {
+		carry[0] = carryBits;
+	}
+}
+
+//! \brief Decompacts a lossless compacted hash value of SWIFFT.
+//! This is the inverse of SWIFFT_compact with carry bits, splitting each number into pairs of digits
+//! of square-root base in 3 steps. In the first step, the quotient by 257^4 of a number of 65 bits
+//! is estimated in double-precision, off by at most one, and then corrected using the remainder modulo 2^64.
+//!
+//! \param[in] compact the compacted hash value of SWIFFT, of size 64 bytes (512 bit).
+//! \param[in] carry the carry bits of the compacted hash value.
+//! \param[out] output the hash value of SWIFFT, of size 128 bytes (1024 bit).
+static inline void SWIFFT_decompact(const BitSequence * LIBSWIFFT_RESTRICT compact, BitSequence carry,
+	BitSequence * LIBSWIFFT_RESTRICT output)
+{
+	const ZVqvec ZQ_0 = ZVQCONST(0), ZQ_1 = ZVQCONST(1), ZQ_10 = ZVQCONST(10), ZQ_17 = ZVQCONST(17), ZQ_18 = ZVQCONST(18), ZQ_26 = ZVQCONST(26);
+	const ZVqvec ZQ_32 = ZVQCONST(32), ZQ_63 = ZVQCONST(63), ZQ_0xffffffff = ZVQCONST(0xffffffff);
+	const ZVqvec ZQ_P4 = ZVQCONST(4362470401ULL); // 257^4
+	const ZVfvec ZF_2P32 = ZVFCONST(4294967296.0), ZF_INV_P4 = ZVFCONST(1.0/4362470401.0);
+	const ZVqvec lows = ZVQLOWS, highs = ZVQHIGHS, indices = ZVQINDICES;
+	const ZVqvec *in = (const ZVqvec *)compact;
+	ZVdvec *out = (ZVdvec *)output;
+	const int nlanes = (int)(sizeof(ZVqvec)/sizeof(uint64_t));
+	int i;
+	for (i=0; i<SWIFFT_COMPACT_BLOCK_SIZE/(int)sizeof(ZVqvec); i++) {
+		ZVqvec w = in[i];
+		ZVqvec c = ((ZQ_0 + (uint64_t)carry) >> (indices + (uint64_t)(i*nlanes))) & ZQ_1;
+		// numbers c*2^64+w to pairs of base-257^4 digits f0+f1*257^4
+		ZVfvec v = SWIFFT_toDoubleV((w >> ZQ_32) | (c << ZQ_32)) * ZF_2P32 + SWIFFT_toDoubleV(w & ZQ_0xffffffff);
+		ZVqvec f1 = SWIFFT_roundV(v * ZF_INV_P4);
+		ZVqvec f0 = w - ((f1 << ZQ_32) + (f1 << ZQ_26) + (f1 << ZQ_18) + (f1 << ZQ_17) + (f1 << ZQ_10) + f1);
+		ZVqvec negative = -(f0 >> ZQ_63);
+		f1 += negative;
+		f0 += negative & ZQ_P4;
+		// base-257^4 digits to pairs of base-257^2 digits, then each of these to pairs of base-257 digits
+		ZVqvec q0 = __builtin_shuffle(f0, f1, lows);
+		ZVqvec q1 = __builtin_shuffle(f0, f1, highs);
+		out[2*i] = SWIFFT_splitDigitsV((ZVdvec)SWIFFT_splitDigits2V(q0));
+		out[2*i+1] = SWIFFT_splitDigitsV((ZVdvec)SWIFFT_splitDigits2V(q1));
+	}
+}
+
+//! \brief Compacts a hash value of SWIFFT.
+//! The result is not composable with other compacted hash values.
+//!
+//! \param[in] output the hash value of SWIFFT, of size 128 bytes (1024 bit).
+//! \param[out] compact the compacted hash value of SWIFFT, of size 64 bytes (512 bit).
+void SWIFFT_ISET_NAME(SWIFFT_Compact_)(const BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
+	BitSequence compact[SWIFFT_COMPACT_BLOCK_SIZE])
+{
+	SWIFFT_compact(output, compact, NULL);
+}
+
 //! \brief Compacts a hash value of SWIFFT for multiple blocks.
 //! The result is not composable with other compacted hash values.
 //!
@@ -324,13 +724,191 @@ void SWIFFT_ISET_NAME(SWIFFT_CompactMultiple_)(int nblocks, const BitSequence *
 	#pragma omp parallel for schedule(static) private(i) if(nblocks > SWIFFT_BLOCKS_PARALLELIZATION_THRESHOLD)
 #endif
 	for (i=0; i<nblocks; i++) {
-		SWIFFT_Compact(
+		SWIFFT_compact(
+			output + i * SWIFFT_OUTPUT_BLOCK_SIZE,
+			compact + i * SWIFFT_COMPACT_BLOCK_SIZE,
+			NULL
+		);
+	}
+}
+
+//! \brief Compacts a hash value of SWIFFT, keeping the carry bits dropped by SWIFFT_Compact.
+//! Together with its carry bits, the compacted hash value is lossless, and SWIFFT_Decompact recovers the hash value from them.
+//!
+//! \param[in] output the hash value of SWIFFT, of size 128 bytes (1024 bit).
+//! \param[out] compact the compacted hash value of SWIFFT, of size 64 bytes (512 bit).
+//! \param[out] carry the carry bits of the compacted hash value, of size 1 byte (8 bit).
+void SWIFFT_ISET_NAME(SWIFFT_CompactWithCarry_)(const BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
+	BitSequence compact[SWIFFT_COMPACT_BLOCK_SIZE], BitSequence carry[SWIFFT_COMPACT_CARRY_SIZE])
+{
+	SWIFFT_compact(output, compact, carry);
+}
+
+//! \brief Compacts a hash value of SWIFFT, keeping the carry bits, for multiple blocks.
+//! The carry bits of all blocks are kept apart from the compacted hash values, so the latter are the same as by SWIFFT_CompactMultiple.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] output the hash value of SWIFFT, of size 128 bytes (1024 bit) per block.
+//! \param[out] compact the compacted hash value of SWIFFT, of size 64 bytes (512 bit) per block.
+//! \param[out] carry the carry bits of the compacted hash value, of size 1 byte (8 bit) per block.
+void SWIFFT_ISET_NAME(SWIFFT_CompactWithCarryMultiple_)(int nblocks, const BitSequence * output,
+	BitSequence * compact, BitSequence * carry)
+{
+	int i;
+#ifdef _OPENMP
+	#pragma omp parallel for schedule(static) private(i) if(nblocks > SWIFFT_BLOCKS_PARALLELIZATION_THRESHOLD)
+#endif
+	for (i=0; i<nblocks; i++) {
+		SWIFFT_compact(
 			output + i * SWIFFT_OUTPUT_BLOCK_SIZE,
-			compact + i * SWIFFT_COMPACT_BLOCK_SIZE
+			compact + i * SWIFFT_COMPACT_BLOCK_SIZE,
+			carry + i * SWIFFT_COMPACT_CARRY_SIZE
+		);
+	}
+}
+
+//! \brief Decompacts a compacted hash value of SWIFFT, given with its carry bits, back to the hash value.
+//! This is the inverse of SWIFFT_CompactWithCarry. The elements of the hash value are canonical, in the range {0,..,SWIFFT_P-1}.
+//!
+//! \param[in] compact the compacted hash value of SWIFFT, of size 64 bytes (512 bit).
+//! \param[in] carry the carry bits of the compacted hash value, of size 1 byte (8 bit).
+//! \param[out] output the hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_Decompact_)(const BitSequence compact[SWIFFT_COMPACT_BLOCK_SIZE],
+	const BitSequence carry[SWIFFT_COMPACT_CARRY_SIZE], BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_decompact(compact, carry[0], output);
+}
+
+//! \brief Decompacts a compacted hash value of SWIFFT, given with its carry bits, for multiple blocks.
+//! This is the inverse of SWIFFT_CompactWithCarryMultiple.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] compact the compacted hash value of SWIFFT, of size 64 bytes (512 bit) per block.
+//! \param[in] carry the carry bits of the compacted hash value, of size 1 byte (8 bit) per block.
+//! \param[out] output the hash value of SWIFFT, of size 128 bytes (1024 bit) per block.
+void SWIFFT_ISET_NAME(SWIFFT_DecompactMultiple_)(int nblocks, const BitSequence * compact,
+	const BitSequence * carry, BitSequence * output)
+{
+	int i;
+#ifdef _OPENMP
+	#pragma omp parallel for schedule(static) private(i) if(nblocks > SWIFFT_BLOCKS_PARALLELIZATION_THRESHOLD)
+#endif
+	for (i=0; i<nblocks; i++) {
+		SWIFFT_decompact(
+			compact + i * SWIFFT_COMPACT_BLOCK_SIZE,
+			carry[i * SWIFFT_COMPACT_CARRY_SIZE],
+			output + i * SWIFFT_OUTPUT_BLOCK_SIZE
 		);
 	}
 }
 
+//! \brief Tests whether two blocks of SWIFFT hash values, or of compacted hash values, are equal.
+//! Hash values are compared element-wise mod 257, so non-canonical elements compare equal to their canonical ones,
+//! whereas compacted hash values are compared bitwise.
+//!
+//! \param[in] block1 the first block.
+//! \param[in] block2 the second block.
+//! \param[in] compact 0 for blocks of hash values, 1 for blocks of compacted hash values.
+//! \returns 1 if the blocks are equal, 0 otherwise.
+static inline int SWIFFT_blocksEqual(const BitSequence * block1, const BitSequence * block2, int compact)
+{
+	const ZOvec *a = (const ZOvec *)block1, *b = (const ZOvec *)block2;
+	int nvecs = (compact ? SWIFFT_COMPACT_BLOCK_SIZE : SWIFFT_OUTPUT_BLOCK_SIZE) / (int)sizeof(ZOvec);
+	ZOvec diff = ZOCONST(0);
+	int j;
+	for (j=0; j<nvecs; j++) {
+		diff |= compact ? a[j] ^ b[j] : SWIFFT_modP(a[j]) ^ SWIFFT_modP(b[j]);
+	}
+	return SWIFFT_isZeroO(diff);
+}
+
+//! \brief Tests whether pairs of blocks of SWIFFT hash values, or of compacted hash values, are equal.
+//! Bit (i mod 8) of byte (i div 8) of the result is set if and only if the i-th pair of blocks is equal.
+//! Each byte of the result holds the bits of 8 pairs, so that no byte is shared between threads.
+//!
+//! \param[in] nblocks the number of pairs of blocks to compare.
+//! \param[in] operand1 the first blocks.
+//! \param[in] operand2 the second blocks.
+//! \param[in] compact 0 for blocks of hash values, 1 for blocks of compacted hash values.
+//! \param[out] equal the bitmap of equality, of size ceil(nblocks/8) bytes.
+static inline void SWIFFT_equalMultiple(int nblocks, const BitSequence * operand1, const BitSequence * operand2,
+	int compact, BitSequence * equal)
+{
+	size_t size = compact ? SWIFFT_COMPACT_BLOCK_SIZE : SWIFFT_OUTPUT_BLOCK_SIZE;
+	int nbytes = (nblocks + 7) >> 3;
+	int i;
+#ifdef _OPENMP
+	#pragma omp parallel for schedule(static) private(i) if(nblocks > SWIFFT_BLOCKS_PARALLELIZATION_THRESHOLD)
+#endif
+	for (i=0; i<nbytes; i++) {
+		int j, n = nblocks - 8*i < 8 ? nblocks - 8*i : 8;
+		BitSequence bits = 0;
+		for (j=0; j<n; j++) {
+			size_t offset = (size_t)(8*i + j) * size;
+			bits |= (BitSequence)(SWIFFT_blocksEqual(operand1 + offset, operand2 + offset, compact) << j);
+		}
+		equal[i] = bits;
+	}
+}
+
+//! \brief Finds the first block of SWIFFT hash values, or of compacted hash values, that is equal to a given one.
+//! The given block is canonicalized once, and each block is rejected as soon as one of its wide SWIFFT vectors differs.
+//!
+//! \param[in] nblocks the number of blocks to search.
+//! \param[in] haystack the blocks to search.
+//! \param[in] needle the block to search for.
+//! \param[in] compact 0 for blocks of hash values, 1 for blocks of compacted hash values.
+//! \returns the index of the first equal block, or -1 if none is equal.
+static inline int SWIFFT_findMatch(int nblocks, const BitSequence * haystack, const BitSequence * needle, int compact)
+{
+	size_t size = compact ? SWIFFT_COMPACT_BLOCK_SIZE : SWIFFT_OUTPUT_BLOCK_SIZE;
+	int nvecs = (int)size / (int)sizeof(ZOvec);
+	const ZOvec *in = (const ZOvec *)needle;
+	ZOvec n[SWIFFT_OUTPUT_BLOCK_SIZE/sizeof(ZOvec)];
+	int i,j;
+	for (j=0; j<nvecs; j++) {
+		n[j] = compact ? in[j] : SWIFFT_modP(in[j]);
+	}
+	for (i=0; i<nblocks; i++) {
+		const ZOvec *h = (const ZOvec *)(haystack + (size_t)i * size);
+		for (j=0; j<nvecs; j++) {
+			if (!SWIFFT_isZeroO((compact ? h[j] : SWIFFT_modP(h[j])) ^ n[j])) {
+				break;
+			}
+		}
+		if (j == nvecs) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+//! \brief Tests whether pairs of compacted SWIFFT hash values are equal for multiple blocks.
+//! Compacted hash values are canonical, so they are compared bitwise.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] compact1 the first compacted hash values of SWIFFT, of size 64 bytes (512 bit) per block.
+//! \param[in] compact2 the second compacted hash values of SWIFFT, of size 64 bytes (512 bit) per block.
+//! \param[out] equal the bitmap of equality, of size ceil(nblocks/8) bytes, whose bit (i mod 8) of byte (i div 8) is set if and only if the i-th pair of blocks is equal.
+void SWIFFT_ISET_NAME(SWIFFT_CompactEqualMultiple_)(int nblocks, const BitSequence * compact1, const BitSequence * compact2,
+	BitSequence * equal)
+{
+	SWIFFT_equalMultiple(nblocks, compact1, compact2, 1, equal);
+}
+
+//! \brief Finds the first of multiple compacted SWIFFT hash values that is equal to a given one.
+//! The search stops at the first equal block.
+//!
+//! \param[in] nblocks the number of blocks to search.
+//! \param[in] haystack the compacted hash values of SWIFFT to search, of size 64 bytes (512 bit) per block.
+//! \param[in] needle the compacted hash value of SWIFFT to search for, of size 64 bytes (512 bit).
+//! \returns the index of the first equal block, or -1 if none is equal.
+int SWIFFT_ISET_NAME(SWIFFT_FindCompactMatch_)(int nblocks, const BitSequence * haystack,
+	const BitSequence needle[SWIFFT_COMPACT_BLOCK_SIZE])
+{
+	return SWIFFT_findMatch(nblocks, haystack, needle, 1);
+}
+
 //! \brief Sets a constant value at each SWIFFT hash value element for multiple blocks.
 //!
 //! \param[in] nblocks the number of blocks to operate on.
@@ -491,48 +1069,2091 @@ void SWIFFT_ISET_NAME(SWIFFT_MulMultiple_)(int nblocks, BitSequence * output,
 	}
 }
 
-//! \brief Computes the result of multiple SWIFFT operations.
-//! The result is composable with other hash values.
+//! \brief Adds the product of two SWIFFT hash values to another, element-wise, for multiple blocks.
 //!
 //! \param[in] nblocks the number of blocks to operate on.
-//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
-//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
-void SWIFFT_ISET_NAME(SWIFFT_ComputeMultiple_)(int nblocks, const BitSequence * input, BitSequence * output)
+//! \param[in,out] output the hash value of SWIFFT to modify.
+//! \param[in] operand1 the first hash value to multiply.
+//! \param[in] operand2 the second hash value to multiply.
+void SWIFFT_ISET_NAME(SWIFFT_MulAddMultiple_)(int nblocks, BitSequence * output,
+        const BitSequence * operand1, const BitSequence * operand2)
 {
 	int i;
 #ifdef _OPENMP
 	#pragma omp parallel for schedule(static) private(i) if(nblocks > SWIFFT_BLOCKS_PARALLELIZATION_THRESHOLD)
 #endif
 	for (i=0; i<nblocks; i++) {
-		SWIFFT_compute(
-			input + i * SWIFFT_INPUT_BLOCK_SIZE,
-			SWIFFT_sign0,
-			output + i * SWIFFT_OUTPUT_BLOCK_SIZE
+		SWIFFT_ISET_NAME(SWIFFT_MulAdd_)(
+			output + i * SWIFFT_OUTPUT_BLOCK_SIZE,
+			operand1 + i * SWIFFT_OUTPUT_BLOCK_SIZE,
+			operand2 + i * SWIFFT_OUTPUT_BLOCK_SIZE
 		);
 	}
 }
 
-//! \brief Computes the result of multiple SWIFFT operations.
-//! The result is composable with other hash values.
+//! \brief Subtracts the product of two SWIFFT hash values from another, element-wise, for multiple blocks.
 //!
 //! \param[in] nblocks the number of blocks to operate on.
-//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
-//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 256 bytes (2048 bit).
-//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
-void SWIFFT_ISET_NAME(SWIFFT_ComputeMultipleSigned_)(int nblocks, const BitSequence * input,
-	const BitSequence * sign, BitSequence * output)
+//! \param[in,out] output the hash value of SWIFFT to modify.
+//! \param[in] operand1 the first hash value to multiply.
+//! \param[in] operand2 the second hash value to multiply.
+void SWIFFT_ISET_NAME(SWIFFT_MulSubMultiple_)(int nblocks, BitSequence * output,
+        const BitSequence * operand1, const BitSequence * operand2)
 {
 	int i;
 #ifdef _OPENMP
 	#pragma omp parallel for schedule(static) private(i) if(nblocks > SWIFFT_BLOCKS_PARALLELIZATION_THRESHOLD)
 #endif
 	for (i=0; i<nblocks; i++) {
-		SWIFFT_compute(
-			input + i * SWIFFT_INPUT_BLOCK_SIZE,
-			sign + i * SWIFFT_INPUT_BLOCK_SIZE,
-			output + i * SWIFFT_OUTPUT_BLOCK_SIZE
+		SWIFFT_ISET_NAME(SWIFFT_MulSub_)(
+			output + i * SWIFFT_OUTPUT_BLOCK_SIZE,
+			operand1 + i * SWIFFT_OUTPUT_BLOCK_SIZE,
+			operand2 + i * SWIFFT_OUTPUT_BLOCK_SIZE
 		);
 	}
 }
 
+//! \brief Adds the product of a SWIFFT hash value and a constant value to another, element-wise, for multiple blocks.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the hash value of SWIFFT to modify, per block.
+//! \param[in] operand the hash value to multiply, per block.
+//! \param[in] multiplier the constant value to multiply by, per block.
+void SWIFFT_ISET_NAME(SWIFFT_ConstMulAddMultiple_)(int nblocks, BitSequence * output,
+        const BitSequence * operand, const int16_t * multiplier)
+{
+	int i;
+#ifdef _OPENMP
+	#pragma omp parallel for schedule(static) private(i) if(nblocks > SWIFFT_BLOCKS_PARALLELIZATION_THRESHOLD)
+#endif
+	for (i=0; i<nblocks; i++) {
+		SWIFFT_ISET_NAME(SWIFFT_ConstMulAdd_)(
+			output + i * SWIFFT_OUTPUT_BLOCK_SIZE,
+			operand + i * SWIFFT_OUTPUT_BLOCK_SIZE,
+			multiplier[i]
+		);
+	}
+}
+
+//! \brief Subtracts the product of a SWIFFT hash value and a constant value from another, element-wise, for multiple blocks.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the hash value of SWIFFT to modify, per block.
+//! \param[in] operand the hash value to multiply, per block.
+//! \param[in] multiplier the constant value to multiply by, per block.
+void SWIFFT_ISET_NAME(SWIFFT_ConstMulSubMultiple_)(int nblocks, BitSequence * output,
+        const BitSequence * operand, const int16_t * multiplier)
+{
+	int i;
+#ifdef _OPENMP
+	#pragma omp parallel for schedule(static) private(i) if(nblocks > SWIFFT_BLOCKS_PARALLELIZATION_THRESHOLD)
+#endif
+	for (i=0; i<nblocks; i++) {
+		SWIFFT_ISET_NAME(SWIFFT_ConstMulSub_)(
+			output + i * SWIFFT_OUTPUT_BLOCK_SIZE,
+			operand + i * SWIFFT_OUTPUT_BLOCK_SIZE,
+			multiplier[i]
+		);
+	}
+}
+
+//! \brief Sets a SWIFFT hash value to another, element-wise, for multiple blocks with the same operand.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[out] output the hash value of SWIFFT to modify, per block.
+//! \param[in] operand the hash value to set to, for all blocks.
+void SWIFFT_ISET_NAME(SWIFFT_SetBroadcast_)(int nblocks, BitSequence * output,
+        const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	int i;
+#ifdef _OPENMP
+	#pragma omp parallel for schedule(static) private(i) if(nblocks > SWIFFT_BLOCKS_PARALLELIZATION_THRESHOLD)
+#endif
+	for (i=0; i<nblocks; i++) {
+		SWIFFT_ISET_NAME(SWIFFT_Set_)(
+			output + (size_t)i * SWIFFT_OUTPUT_BLOCK_SIZE,
+			operand
+		);
+	}
+}
+
+//! \brief Adds a SWIFFT hash value to another, element-wise, for multiple blocks with the same operand.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the hash value of SWIFFT to modify, per block.
+//! \param[in] operand the hash value to add, for all blocks.
+void SWIFFT_ISET_NAME(SWIFFT_AddBroadcast_)(int nblocks, BitSequence * output,
+        const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	int i;
+#ifdef _OPENMP
+	#pragma omp parallel for schedule(static) private(i) if(nblocks > SWIFFT_BLOCKS_PARALLELIZATION_THRESHOLD)
+#endif
+	for (i=0; i<nblocks; i++) {
+		SWIFFT_ISET_NAME(SWIFFT_Add_)(
+			output + (size_t)i * SWIFFT_OUTPUT_BLOCK_SIZE,
+			operand
+		);
+	}
+}
+
+//! \brief Subtracts a SWIFFT hash value from another, element-wise, for multiple blocks with the same operand.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the hash value of SWIFFT to modify, per block.
+//! \param[in] operand the hash value to subtract, for all blocks.
+void SWIFFT_ISET_NAME(SWIFFT_SubBroadcast_)(int nblocks, BitSequence * output,
+        const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	int i;
+#ifdef _OPENMP
+	#pragma omp parallel for schedule(static) private(i) if(nblocks > SWIFFT_BLOCKS_PARALLELIZATION_THRESHOLD)
+#endif
+	for (i=0; i<nblocks; i++) {
+		SWIFFT_ISET_NAME(SWIFFT_Sub_)(
+			output + (size_t)i * SWIFFT_OUTPUT_BLOCK_SIZE,
+			operand
+		);
+	}
+}
+
+//! \brief Multiplies a SWIFFT hash value by another, element-wise, for multiple blocks with the same operand.
+//! The operand is centered once for all blocks.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the hash value of SWIFFT to modify, per block.
+//! \param[in] operand the hash value to multiply by, for all blocks.
+void SWIFFT_ISET_NAME(SWIFFT_MulBroadcast_)(int nblocks, BitSequence * output,
+        const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	ZOvec zoperand[SWIFFT_OUTPUT_BLOCK_SIZE/sizeof(ZOvec)];
+	const ZOvec *zsource = (const ZOvec *)operand;
+	size_t size = SWIFFT_OUTPUT_BLOCK_SIZE/sizeof(ZOvec);
+	size_t j;
+	int i;
+	for (j=0; j<size; j++) {
+		zoperand[j] = SWIFFT_centerP(zsource[j]);
+	}
+#ifdef _OPENMP
+	#pragma omp parallel for schedule(static) private(i,j) if(nblocks > SWIFFT_BLOCKS_PARALLELIZATION_THRESHOLD)
+#endif
+	for (i=0; i<nblocks; i++) {
+		ZOvec *zoutput = (ZOvec *)(output + (size_t)i * SWIFFT_OUTPUT_BLOCK_SIZE);
+		for (j=0; j<size; j++) {
+			// products of centered elements are in {-128*128,..,128*128} so do not overflow
+			zoutput[j] = SWIFFT_modP(SWIFFT_centerP(zoutput[j]) * zoperand[j]);
+		}
+	}
+}
+
+//! \brief Sets SWIFFT hash values to the products of one SWIFFT hash value by constant values.
+//! The operand is centered once for all blocks, and each block of output is written without being read.
+//!
+//! \param[in] nblocks the number of blocks to operate on, one per constant value.
+//! \param[out] output the hash value of SWIFFT to set, per block.
+//! \param[in] operand the hash value to multiply, for all blocks.
+//! \param[in] multiplier the constant value to multiply by, per block.
+void SWIFFT_ISET_NAME(SWIFFT_ConstMulOuter_)(int nblocks, BitSequence * output,
+        const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE], const int16_t * multiplier)
+{
+	ZOvec zoperand[SWIFFT_OUTPUT_BLOCK_SIZE/sizeof(ZOvec)];
+	const ZOvec *zsource = (const ZOvec *)operand;
+	size_t size = SWIFFT_OUTPUT_BLOCK_SIZE/sizeof(ZOvec);
+	size_t j;
+	int i;
+	for (j=0; j<size; j++) {
+		zoperand[j] = SWIFFT_centerP(zsource[j]);
+	}
+#ifdef _OPENMP
+	#pragma omp parallel for schedule(static) private(i,j) if(nblocks > SWIFFT_BLOCKS_PARALLELIZATION_THRESHOLD)
+#endif
+	for (i=0; i<nblocks; i++) {
+		const ZOvec zmultiplier = SWIFFT_centerP(SWIFFT_modP((ZOvec)ZOCONST(multiplier[i])));
+		ZOvec *zoutput = (ZOvec *)(output + (size_t)i * SWIFFT_OUTPUT_BLOCK_SIZE);
+		for (j=0; j<size; j++) {
+			// products of centered elements are in {-128*128,..,128*128} so do not overflow
+			zoutput[j] = SWIFFT_modP(zoperand[j] * zmultiplier);
+		}
+	}
+}
+
+#define SWIFFT_LINEAR_COMBINATION_REDUCE_INTERVAL 16384 ///< Number of pairs of terms accumulated into 32-bit elements between reductions
+
+//! \brief Reduces a coefficient mod 257 to the range {-128,..,128}.
+//! \param[in] c the coefficient.
+//! \returns the reduced coefficient.
+static inline int16_t SWIFFT_centerCoefficient(int16_t c)
+{
+	int16_t r = c % SWIFFT_P;
+	return (r > SWIFFT_P/2) ? r - SWIFFT_P : (r < -(SWIFFT_P/2)) ? r + SWIFFT_P : r;
+}
+
+//! \brief Computes a linear combination of SWIFFT hash values, element-wise.
+//! Pairs of terms are multiplied-and-added into 32-bit elements, each pair contributing at most
+//! 2*128*256 in absolute value, which are reduced every SWIFFT_LINEAR_COMBINATION_REDUCE_INTERVAL pairs.
+//!
+//! \param[in] n the number of terms.
+//! \param[in] coeffs the coefficients of the terms.
+//! \param[in] operand the hash value of each term, per block, with elements in the range {0,..,SWIFFT_P-1}.
+//! \param[out] output the hash value of SWIFFT to set to the linear combination.
+static inline void SWIFFT_linearCombination(int n, const int16_t * LIBSWIFFT_RESTRICT coeffs,
+	const BitSequence * LIBSWIFFT_RESTRICT operand, BitSequence * LIBSWIFFT_RESTRICT output)
+{
+	const size_t size = SWIFFT_OUTPUT_BLOCK_SIZE/sizeof(ZOvec);
+	const ZOvec *zoperand = (const ZOvec *)operand;
+	ZOvec *zoutput = (ZOvec *)output;
+	ZOdvec acc[SWIFFT_OUTPUT_BLOCK_SIZE/sizeof(ZOvec)][2];
+	size_t j;
+	int i, k = 0;
+	for (j=0; j<size; j++) {
+		acc[j][0] = acc[j][1] = (ZOdvec)ZDCONST(0);
+	}
+	for (i=0; i+1<n; i+=2,zoperand+=2*size) {
+		const ZOvec c0 = ZOCONST(SWIFFT_centerCoefficient(coeffs[i]));
+		const ZOvec c1 = ZOCONST(SWIFFT_centerCoefficient(coeffs[i+1]));
+		for (j=0; j<size; j++) {
+			SWIFFT_maddPairO(acc[j], zoperand[j], zoperand[size+j], c0, c1);
+		}
+		if (++k == SWIFFT_LINEAR_COMBINATION_REDUCE_INTERVAL) {
+			for (j=0; j<size; j++) {
+				acc[j][0] = SWIFFT_dReduce(acc[j][0]);
+				acc[j][1] = SWIFFT_dReduce(acc[j][1]);
+			}
+			k = 0;
+		}
+	}
+	if (i < n) {
+		// the last term of an odd number of terms is paired with a zero term
+		const ZOvec c0 = ZOCONST(SWIFFT_centerCoefficient(coeffs[i]));
+		const ZOvec zero = ZOCONST(0);
+		for (j=0; j<size; j++) {
+			SWIFFT_maddPairO(acc[j], zoperand[j], zero, c0, zero);
+		}
+	}
+	for (j=0; j<size; j++) {
+		zoutput[j] = SWIFFT_modP(SWIFFT_packReduce(acc[j]));
+	}
+}
+
+//! \brief Computes a linear combination of SWIFFT hash values, element-wise.
+//! The sum of products is accumulated into 32-bit elements and reduced mod 257 once.
+//!
+//! \param[in] n the number of terms.
+//! \param[in] coeffs the coefficients of the terms.
+//! \param[in] operand the hash value of each term, per block, with elements in the range {0,..,SWIFFT_P-1},
+//! as output by LibSWIFFT; other elements must first be canonicalized using SWIFFT_Canonicalize.
+//! \param[out] output the hash value of SWIFFT to set to the linear combination.
+void SWIFFT_ISET_NAME(SWIFFT_LinearCombination_)(int n, const int16_t * coeffs,
+	const BitSequence * operand, BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_linearCombination(n, coeffs, operand, output);
+}
+
+//! \brief Computes linear combinations of SWIFFT hash values, element-wise, for multiple blocks.
+//! The linear combination for each output block has its own n coefficients and n operand blocks.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] n the number of terms per block.
+//! \param[in] coeffs the coefficients of the terms, n per block.
+//! \param[in] operand the hash value of each term, n blocks per block, with elements in the range {0,..,SWIFFT_P-1},
+//! as output by LibSWIFFT; other elements must first be canonicalized using SWIFFT_CanonicalizeMultiple.
+//! \param[out] output the hash value of SWIFFT to set to the linear combination, per block.
+void SWIFFT_ISET_NAME(SWIFFT_LinearCombinationMultiple_)(int nblocks, int n, const int16_t * coeffs,
+	const BitSequence * operand, BitSequence * output)
+{
+	int i;
+#ifdef _OPENMP
+	#pragma omp parallel for schedule(static) private(i) if(nblocks > SWIFFT_BLOCKS_PARALLELIZATION_THRESHOLD)
+#endif
+	for (i=0; i<nblocks; i++) {
+		SWIFFT_linearCombination(n,
+			coeffs + (size_t)i * n,
+			operand + (size_t)i * n * SWIFFT_OUTPUT_BLOCK_SIZE,
+			output + i * SWIFFT_OUTPUT_BLOCK_SIZE
+		);
+	}
+}
+
+#ifndef SWIFFT_MATMUL_ROWS
+	//! Number of rows of the matrix to multiply in interleaved fashion, reusing each loaded hash value, one of 1, 2, 3, or 4
+	#define SWIFFT_MATMUL_ROWS 4
+#endif
+
+#define SWIFFT_MATMUL_COLUMNS 128 ///< Number of columns per tile, over which 32-bit sums of products cannot overflow
+
+//! \brief Multiplies a tile of a matrix by a tile of a vector of SWIFFT hash values, adding to a tile of the resulting vector.
+//! Pairs of columns are multiplied-and-added into 32-bit elements, each pair contributing at most
+//! 2*2^15*256 in absolute value, so any 16-bit coefficients of up to SWIFFT_MATMUL_COLUMNS columns cannot overflow.
+//!
+//! \param[in] nr the number of rows of the tile, a compile-time constant of at most 4.
+//! \param[in] ncols the number of columns of the tile, at most SWIFFT_MATMUL_COLUMNS.
+//! \param[in] n the number of columns of the matrix, i.e., the distance between its rows.
+//! \param[in] matrix the tile of the matrix, in row-major order.
+//! \param[in] operand the tile of the vector of hash values, with elements in the range {0,..,SWIFFT_P-1}.
+//! \param[in,out] output the tile of the resulting vector, with elements in the range {-2*255-128,..,2*255+127}.
+//! \param[in] first whether this is the first tile of columns, which sets rather than adds to the resulting vector.
+static inline void SWIFFT_matMulTile(int nr, int ncols, int n, const int16_t * LIBSWIFFT_RESTRICT matrix,
+	const BitSequence * LIBSWIFFT_RESTRICT operand, BitSequence * LIBSWIFFT_RESTRICT output, int first)
+{
+	const size_t size = SWIFFT_OUTPUT_BLOCK_SIZE/sizeof(ZOvec);
+	const ZOvec *zoperand = (const ZOvec *)operand;
+	const ZOvec zero = ZOCONST(0);
+	ZOdvec acc[nr][SWIFFT_OUTPUT_BLOCK_SIZE/sizeof(ZOvec)][2];
+	int32_t pair;
+	size_t l;
+	int r, j;
+	for (r=0; r<nr; r++) {
+		for (l=0; l<size; l++) {
+			acc[r][l][0] = acc[r][l][1] = (ZOdvec)ZDCONST(0);
+		}
+	}
+	for (j=0; j+1<ncols; j+=2,zoperand+=2*size) {
+		for (r=0; r<nr; r++) {
+			// a pair of adjacent coefficients is already interleaved in memory
+			memcpy(&pair, matrix + (size_t)r * n + j, sizeof(pair));
+			const ZOvec c = (ZOvec)(ZOdvec)ZDCONST(pair);
+			for (l=0; l<size; l++) {
+				SWIFFT_maddConstPairO(acc[r][l], zoperand[l], zoperand[size+l], c);
+			}
+		}
+	}
+	if (j < ncols) {
+		// the last column of an odd number of columns is paired with a zero column
+		for (r=0; r<nr; r++) {
+			pair = (uint16_t)matrix[(size_t)r * n + j];
+			const ZOvec c = (ZOvec)(ZOdvec)ZDCONST(pair);
+			for (l=0; l<size; l++) {
+				SWIFFT_maddConstPairO(acc[r][l], zoperand[l], zero, c);
+			}
+		}
+	}
+	for (r=0; r<nr; r++) {
+		ZOvec *zoutput = (ZOvec *)(output + (size_t)r * SWIFFT_OUTPUT_BLOCK_SIZE);
+		for (l=0; l<size; l++) {
+			ZOvec sum = SWIFFT_packReduce(acc[r][l]);
+			zoutput[l] = first ? sum : SWIFFT_qReduce(zoutput[l] + sum);
+		}
+	}
+}
+
+//! \brief Multiplies a matrix by a vector of SWIFFT hash values, over Z_257.
+//! The matrix is processed in tiles of SWIFFT_MATMUL_ROWS rows by SWIFFT_MATMUL_COLUMNS columns, so that
+//! each loaded hash value is used for several rows while the matrix is read sequentially, and the resulting
+//! vector accumulates the tiles of columns with lazy reduction and is reduced once. Tiles of rows are
+//! computed in parallel when built with OpenMP.
+//!
+//! \param[in] k the number of rows of the matrix.
+//! \param[in] n the number of columns of the matrix.
+//! \param[in] matrix the matrix of k*n coefficients, in row-major order.
+//! \param[in] operand the vector of n hash values, with elements in the range {0,..,SWIFFT_P-1}.
+//! \param[out] output the resulting vector of k hash values.
+void SWIFFT_ISET_NAME(SWIFFT_MatMulOutputs_)(int k, int n, const int16_t * matrix,
+	const BitSequence * operand, BitSequence * output)
+{
+	int ntiles = (k + SWIFFT_MATMUL_ROWS - 1) / SWIFFT_MATMUL_ROWS;
+	if (n <= 0) {
+		memset(output, 0, (size_t)k * SWIFFT_OUTPUT_BLOCK_SIZE);
+		return;
+	}
+#ifdef _OPENMP
+	#pragma omp parallel if(k > SWIFFT_BLOCKS_PARALLELIZATION_THRESHOLD)
+#endif
+	{
+		int c, i;
+#ifdef _OPENMP
+		#pragma omp for schedule(static)
+#endif
+		for (i=0; i<ntiles; i++) {
+			int r = i * SWIFFT_MATMUL_ROWS;
+			for (c=0; c<n; c+=SWIFFT_MATMUL_COLUMNS) {
+				int ncols = (n - c < SWIFFT_MATMUL_COLUMNS) ? n - c : SWIFFT_MATMUL_COLUMNS;
+				const int16_t *mtile = matrix + (size_t)r * n + c;
+				const BitSequence *otile = operand + (size_t)c * SWIFFT_OUTPUT_BLOCK_SIZE;
+				BitSequence *ytile = output + (size_t)r * SWIFFT_OUTPUT_BLOCK_SIZE;
+				// instantiating the kernel with a constant number of rows
+				switch (k - r < SWIFFT_MATMUL_ROWS ? k - r : SWIFFT_MATMUL_ROWS) {
+				case 4:
+					SWIFFT_matMulTile(4, ncols, n, mtile, otile, ytile, c == 0);
+					break;
+				case 3:
+					SWIFFT_matMulTile(3, ncols, n, mtile, otile, ytile, c == 0);
+					break;
+				case 2:
+					SWIFFT_matMulTile(2, ncols, n, mtile, otile, ytile, c == 0);
+					break;
+				default:
+					SWIFFT_matMulTile(1, ncols, n, mtile, otile, ytile, c == 0);
+					break;
+				}
+			}
+		}
+#ifdef _OPENMP
+		#pragma omp for schedule(static)
+#endif
+		for (i=0; i<k; i++) {
+			ZOvec *zoutput = (ZOvec *)(output + (size_t)i * SWIFFT_OUTPUT_BLOCK_SIZE);
+			size_t l;
+			for (l=0; l<SWIFFT_OUTPUT_BLOCK_SIZE/sizeof(ZOvec); l++) {
+				zoutput[l] = SWIFFT_modP(zoutput[l]);
+			}
+		}
+	}
+}
+
+//! \brief Multiplies a wide SWIFFT vector element-wise by a power of 2 mod 257.
+//!
+//! \param[in] x the wide SWIFFT vector.
+//! \param[in] e the exponent of 2, normally a compile-time constant.
+//! \returns the product, in a range like that of SWIFFT_shift.
+static inline ZOvec SWIFFT_mulPow2(ZOvec x, int e)
+{
+	// 2^8 = -1 and 2^16 = 1 mod 257
+	e &= 15;
+	if (e >= 8) {
+		x = -x;
+		e -= 8;
+	}
+	return e == 0 ? x : SWIFFT_shift(x, e);
+}
+
+//! \brief Computes 8-point transforms of the elements across 8 wide SWIFFT vectors, with a root of unity that is a power of 2.
+//! The k-th resulting vector is the sum over n of the n-th vector multiplied by 2^(s*n*k), computed with butterflies.
+//!
+//! \param[in,out] v the 8 wide SWIFFT vectors, each in the range {-128+1,3*128-1}.
+//! \param[in] s the exponent of 2 of the root of unity.
+static inline void SWIFFT_dft8O(ZOvec v[8], int s)
+{
+	int i,j,len;
+	ZOvec a[8];
+
+	for (i=0; i<8; i++) {
+		a[i] = v[((i & 1) << 2) | (i & 2) | ((i & 4) >> 2)];
+	}
+	for (len=2; len<=8; len<<=1) {
+		for (i=0; i<8; i+=len) {
+			for (j=0; j<len/2; j++) {
+				ZOvec t = SWIFFT_mulPow2(a[i+j+len/2], s*j*(8/len));
+				a[i+j+len/2] = a[i+j] - t;
+				a[i+j] += t;
+			}
+		}
+		for (i=0; i<8; i++) {
+			a[i] = SWIFFT_qReduce(a[i]);
+		}
+	}
+	for (i=0; i<8; i++) {
+		v[i] = a[i];
+	}
+}
+
+//! \brief Computes the transform between the evaluation and coefficient forms of SWIFFT_O hash values.
+//! The i-th element of a hash value is the evaluation at OMEGA^(2i+1) of a polynomial mod x^64+1, which is
+//! a transform with OMEGA^2 of its coefficients twisted by powers of OMEGA. The transform of 64 elements is
+//! done as 8-point transforms across the 8 vectors, multiplication by twiddle factors, transposition and
+//! 8-point transforms across the 8 vectors again. The 8-point transforms have the root of unity OMEGA^16 = 2^2.
+//!
+//! \param[in,out] v the 8 wide SWIFFT vectors of the hash values, each in its own part, in the range {0,..,SWIFFT_P-1}.
+//! \param[in] inverse 0 for the transform from coefficients to evaluations, 1 for the inverse transform.
+static inline void SWIFFT_nttO(ZOvec v[8], int inverse)
+{
+	const ZOvec *twist = (const ZOvec *)(inverse ? SWIFFT_inttTwistO : SWIFFT_nttTwistO);
+	const ZOvec *twiddle = (const ZOvec *)(inverse ? SWIFFT_inttTwiddleO : SWIFFT_nttTwiddleO);
+	int s = inverse ? 16 - 2 : 2;
+	int k;
+
+	if (!inverse) {
+		for (k=0; k<8; k++) {
+			v[k] = SWIFFT_qReduce(SWIFFT_centerP(v[k]) * twist[k << (SWIFFT_MAX_LOG2_O - SWIFFT_LOG2_O)]);
+		}
+	}
+	SWIFFT_dft8O(v, s);
+	for (k=0; k<8; k++) {
+		v[k] = SWIFFT_qReduce(SWIFFT_centerP(v[k]) * twiddle[k << (SWIFFT_MAX_LOG2_O - SWIFFT_LOG2_O)]);
+	}
+	SWIFFT_transposeO(v);
+	SWIFFT_dft8O(v, s);
+	if (inverse) {
+		for (k=0; k<8; k++) {
+			v[k] = SWIFFT_qReduce(SWIFFT_centerP(v[k]) * twist[k << (SWIFFT_MAX_LOG2_O - SWIFFT_LOG2_O)]);
+		}
+	}
+	for (k=0; k<8; k++) {
+		v[k] = SWIFFT_modP(v[k]);
+	}
+}
+
+//! \brief Transforms SWIFFT_O consecutive hash values between the evaluation and coefficient forms.
+//!
+//! \param[in,out] output the SWIFFT_O hash values of SWIFFT to transform, each of size 128 bytes (1024 bit).
+//! \param[in] inverse 0 for the transform from coefficients to evaluations, 1 for the inverse transform.
+static inline void SWIFFT_transformO(BitSequence * output, int inverse)
+{
+	int j,k;
+	ZOvec v[8];
+	const Z1vec *in = (const Z1vec *)output;
+
+	for (k=0; k<8; k++) {
+		int idx[SWIFFT_O];
+		for (j=0; j<SWIFFT_O; j++) {
+			idx[j] = 8*j + k;
+		}
+		v[k] = SWIFFT_gatherO(in, idx);
+	}
+	SWIFFT_nttO(v, inverse);
+	SWIFFT_storeTransposedO(v, (Z1vec *)output);
+}
+
+//! \brief Transforms multiple hash values between the evaluation and coefficient forms.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the blocks of hash values of SWIFFT to transform, each of size 128 bytes (1024 bit).
+//! \param[in] inverse 0 for the transform from coefficients to evaluations, 1 for the inverse transform.
+static inline void SWIFFT_transformMultiple(int nblocks, BitSequence * output, int inverse)
+{
+	int i;
+	int nfull = nblocks & ~(SWIFFT_O - 1);
+#ifdef _OPENMP
+	#pragma omp parallel for schedule(static) private(i) if(nblocks > SWIFFT_BLOCKS_PARALLELIZATION_THRESHOLD)
+#endif
+	for (i=0; i<nfull; i+=SWIFFT_O) {
+		SWIFFT_transformO(output + (size_t)i*SWIFFT_OUTPUT_BLOCK_SIZE, inverse);
+	}
+	if (nfull < nblocks) {
+		// transforming the remaining blocks padded with zero blocks
+		SWIFFT_ALIGN BitSequence tmp[SWIFFT_O*SWIFFT_OUTPUT_BLOCK_SIZE] = {0};
+		size_t size = (size_t)(nblocks - nfull)*SWIFFT_OUTPUT_BLOCK_SIZE;
+		memcpy(tmp, output + (size_t)nfull*SWIFFT_OUTPUT_BLOCK_SIZE, size);
+		SWIFFT_transformO(tmp, inverse);
+		memcpy(output + (size_t)nfull*SWIFFT_OUTPUT_BLOCK_SIZE, tmp, size);
+	}
+}
+
+//! \brief Transforms a SWIFFT hash value from the evaluation form to the coefficient form.
+//! The i-th element of a hash value is the evaluation at OMEGA^(2i+1), for the 128-th root of unity OMEGA = 42,
+//! of a polynomial in Z_{257}[x]/(x^64+1), whose i-th coefficient becomes the i-th element.
+//!
+//! \param[in,out] output the hash value of SWIFFT to transform, of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ToCoefficients_)(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_transformMultiple(1, output, 1);
+}
+
+//! \brief Transforms a SWIFFT hash value from the coefficient form to the evaluation form.
+//! The i-th coefficient of a polynomial in Z_{257}[x]/(x^64+1), given as the i-th element, becomes its evaluation at
+//! OMEGA^(2i+1), for the 128-th root of unity OMEGA = 42, the same as for hash values. This is the inverse of SWIFFT_ToCoefficients.
+//!
+//! \param[in,out] output the hash value of SWIFFT to transform, of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_FromCoefficients_)(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_transformMultiple(1, output, 0);
+}
+
+//! \brief Transforms multiple SWIFFT hash values from the evaluation form to the coefficient form.
+//! This is SWIFFT_ToCoefficients for each block.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the blocks of hash values of SWIFFT to transform, each of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ToCoefficientsMultiple_)(int nblocks, BitSequence * output)
+{
+	SWIFFT_transformMultiple(nblocks, output, 1);
+}
+
+//! \brief Transforms multiple SWIFFT hash values from the coefficient form to the evaluation form.
+//! This is SWIFFT_FromCoefficients for each block.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the blocks of hash values of SWIFFT to transform, each of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_FromCoefficientsMultiple_)(int nblocks, BitSequence * output)
+{
+	SWIFFT_transformMultiple(nblocks, output, 0);
+}
+
+//! \brief Canonicalizes a hash value of SWIFFT, reducing each element mod 257 to the range {0,..,SWIFFT_P-1}.
+//!
+//! \param[in,out] output the hash value of SWIFFT to canonicalize, of size 128 bytes (1024 bit).
+static inline void SWIFFT_canonicalize(BitSequence * output)
+{
+	ZOvec *v = (ZOvec *)output;
+	int j;
+	for (j=0; j<8/SWIFFT_O; j++) {
+		v[j] = SWIFFT_modP(v[j]);
+	}
+}
+
+//! \brief Canonicalizes a SWIFFT hash value, reducing each element mod 257 to the range {0,..,SWIFFT_P-1}.
+//! Hash values computed by LibSWIFFT are canonical already; this is for elements coming from elsewhere, e.g. in the range of a partial reduction.
+//!
+//! \param[in,out] output the hash value of SWIFFT to canonicalize, of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_Canonicalize_)(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_canonicalize(output);
+}
+
+//! \brief Canonicalizes multiple SWIFFT hash values.
+//! This is SWIFFT_Canonicalize for each block.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the blocks of hash values of SWIFFT to canonicalize, each of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_CanonicalizeMultiple_)(int nblocks, BitSequence * output)
+{
+	int i;
+#ifdef _OPENMP
+	#pragma omp parallel for schedule(static) private(i) if(nblocks > SWIFFT_BLOCKS_PARALLELIZATION_THRESHOLD)
+#endif
+	for (i=0; i<nblocks; i++) {
+		SWIFFT_canonicalize(output + (size_t)i*SWIFFT_OUTPUT_BLOCK_SIZE);
+	}
+}
+
+//! \brief Tests whether two SWIFFT hash values are equal.
+//! Elements are compared mod 257, so a non-canonical element compares equal to its canonical one.
+//!
+//! \param[in] operand1 the first hash value of SWIFFT, of size 128 bytes (1024 bit).
+//! \param[in] operand2 the second hash value of SWIFFT, of size 128 bytes (1024 bit).
+//! \returns 1 if the hash values are equal, 0 otherwise.
+int SWIFFT_ISET_NAME(SWIFFT_Equal_)(const BitSequence operand1[SWIFFT_OUTPUT_BLOCK_SIZE], const BitSequence operand2[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	return SWIFFT_blocksEqual(operand1, operand2, 0);
+}
+
+//! \brief Tests whether pairs of SWIFFT hash values are equal for multiple blocks.
+//! This is SWIFFT_Equal for each pair of blocks, with the results packed into a bitmap.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] operand1 the first hash values of SWIFFT, of size 128 bytes (1024 bit) per block.
+//! \param[in] operand2 the second hash values of SWIFFT, of size 128 bytes (1024 bit) per block.
+//! \param[out] equal the bitmap of equality, of size ceil(nblocks/8) bytes, whose bit (i mod 8) of byte (i div 8) is set if and only if the i-th pair of blocks is equal.
+void SWIFFT_ISET_NAME(SWIFFT_EqualMultiple_)(int nblocks, const BitSequence * operand1, const BitSequence * operand2,
+	BitSequence * equal)
+{
+	SWIFFT_equalMultiple(nblocks, operand1, operand2, 0, equal);
+}
+
+//! \brief Finds the first of multiple SWIFFT hash values that is equal to a given one.
+//! Elements are compared mod 257, as in SWIFFT_Equal. The search stops at the first equal block.
+//!
+//! \param[in] nblocks the number of blocks to search.
+//! \param[in] haystack the hash values of SWIFFT to search, of size 128 bytes (1024 bit) per block.
+//! \param[in] needle the hash value of SWIFFT to search for, of size 128 bytes (1024 bit).
+//! \returns the index of the first equal block, or -1 if none is equal.
+int SWIFFT_ISET_NAME(SWIFFT_FindMatch_)(int nblocks, const BitSequence * haystack,
+	const BitSequence needle[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	return SWIFFT_findMatch(nblocks, haystack, needle, 0);
+}
+
+#define SWIFFT_ACCUMULATOR_REDUCED_LOW (-128+1)   ///< Lower bound on the elements of a reduced SWIFFT accumulator
+#define SWIFFT_ACCUMULATOR_REDUCED_HIGH (3*128-1)  ///< Upper bound on the elements of a reduced SWIFFT accumulator
+#define SWIFFT_ACCUMULATOR_OPERAND_HIGH (SWIFFT_P-1) ///< Upper bound on the elements of an accumulated hash value
+
+//! \brief Reduces the elements of a SWIFFT accumulator to the range
+//! {SWIFFT_ACCUMULATOR_REDUCED_LOW,..,SWIFFT_ACCUMULATOR_REDUCED_HIGH}, without changing its sum mod 257.
+//!
+//! \param[in,out] accumulator the SWIFFT accumulator to reduce.
+static inline void SWIFFT_accumulatorReduce(swifft_accumulator_t * accumulator)
+{
+	size_t i;
+	ZOvec *zsum = (ZOvec *)accumulator->sum;
+	size_t size = SWIFFT_OUTPUT_BLOCK_SIZE/sizeof(ZOvec);
+	for (i=0; i<size; i++,zsum++) {
+		*zsum = SWIFFT_qReduce(*zsum);
+	}
+	accumulator->low = SWIFFT_ACCUMULATOR_REDUCED_LOW;
+	accumulator->high = SWIFFT_ACCUMULATOR_REDUCED_HIGH;
+}
+
+//! \brief Accumulates SWIFFT hash values of multiple blocks into a SWIFFT accumulator, element-wise.
+//! Runs of blocks are summed in registers, with a reduction only between runs that might overflow.
+//!
+//! \param[in,out] accumulator the SWIFFT accumulator to modify.
+//! \param[in] nblocks the number of blocks to accumulate.
+//! \param[in] operand the hash value to accumulate, per block, with elements in the range {0,..,SWIFFT_P-1}.
+//! \param[in] sub whether to subtract rather than add, a compile-time constant.
+static inline void SWIFFT_accumulate(swifft_accumulator_t * accumulator, int nblocks,
+	const BitSequence * operand, int sub)
+{
+	size_t i;
+	ZOvec *zsum = (ZOvec *)accumulator->sum;
+	size_t size = SWIFFT_OUTPUT_BLOCK_SIZE/sizeof(ZOvec);
+	while (nblocks > 0) {
+		int32_t headroom = sub ? accumulator->low - INT16_MIN : INT16_MAX - accumulator->high;
+		int n = headroom / SWIFFT_ACCUMULATOR_OPERAND_HIGH;
+		if (n == 0) {
+			SWIFFT_accumulatorReduce(accumulator);
+			continue;
+		}
+		if (n > nblocks) {
+			n = nblocks;
+		}
+		for (i=0; i<size; i++) {
+			const ZOvec *zoperand = ((const ZOvec *)operand) + i;
+			ZOvec acc = zsum[i];
+			int b;
+			for (b=0; b<n; b++,zoperand+=size) {
+				acc = sub ? acc - *zoperand : acc + *zoperand;
+			}
+			zsum[i] = acc;
+		}
+		if (sub) {
+			accumulator->low -= n * SWIFFT_ACCUMULATOR_OPERAND_HIGH;
+		} else {
+			accumulator->high += n * SWIFFT_ACCUMULATOR_OPERAND_HIGH;
+		}
+		nblocks -= n;
+		operand += n * SWIFFT_OUTPUT_BLOCK_SIZE;
+	}
+}
+
+//! \brief Initializes a SWIFFT accumulator to a zero sum.
+//!
+//! \param[out] accumulator the SWIFFT accumulator to initialize.
+void SWIFFT_ISET_NAME(SWIFFT_AccumulatorInit_)(swifft_accumulator_t * accumulator)
+{
+	memset(accumulator->sum, 0, sizeof(accumulator->sum));
+	accumulator->low = 0;
+	accumulator->high = 0;
+}
+
+//! \brief Adds a SWIFFT hash value to a SWIFFT accumulator, element-wise, without reducing it.
+//!
+//! \param[in,out] accumulator the SWIFFT accumulator to modify.
+//! \param[in] operand the hash value to add, with elements in the range {0,..,SWIFFT_P-1}.
+void SWIFFT_ISET_NAME(SWIFFT_AccumulatorAdd_)(swifft_accumulator_t * accumulator,
+	const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_accumulate(accumulator, 1, operand, 0);
+}
+
+//! \brief Subtracts a SWIFFT hash value from a SWIFFT accumulator, element-wise, without reducing it.
+//!
+//! \param[in,out] accumulator the SWIFFT accumulator to modify.
+//! \param[in] operand the hash value to subtract, with elements in the range {0,..,SWIFFT_P-1}.
+void SWIFFT_ISET_NAME(SWIFFT_AccumulatorSub_)(swifft_accumulator_t * accumulator,
+	const BitSequence operand[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_accumulate(accumulator, 1, operand, 1);
+}
+
+//! \brief Adds SWIFFT hash values of multiple blocks to a SWIFFT accumulator, element-wise, without reducing it.
+//!
+//! \param[in,out] accumulator the SWIFFT accumulator to modify.
+//! \param[in] nblocks the number of blocks to add.
+//! \param[in] operand the hash value to add, per block, with elements in the range {0,..,SWIFFT_P-1}.
+void SWIFFT_ISET_NAME(SWIFFT_AccumulatorAddMultiple_)(swifft_accumulator_t * accumulator, int nblocks,
+	const BitSequence * operand)
+{
+	SWIFFT_accumulate(accumulator, nblocks, operand, 0);
+}
+
+//! \brief Subtracts SWIFFT hash values of multiple blocks from a SWIFFT accumulator, element-wise, without reducing it.
+//!
+//! \param[in,out] accumulator the SWIFFT accumulator to modify.
+//! \param[in] nblocks the number of blocks to subtract.
+//! \param[in] operand the hash value to subtract, per block, with elements in the range {0,..,SWIFFT_P-1}.
+void SWIFFT_ISET_NAME(SWIFFT_AccumulatorSubMultiple_)(swifft_accumulator_t * accumulator, int nblocks,
+	const BitSequence * operand)
+{
+	SWIFFT_accumulate(accumulator, nblocks, operand, 1);
+}
+
+//! \brief Gets the sum of a SWIFFT accumulator as a SWIFFT hash value, reduced mod 257.
+//!
+//! \param[in] accumulator the SWIFFT accumulator.
+//! \param[out] output the hash value of SWIFFT to set to the sum.
+void SWIFFT_ISET_NAME(SWIFFT_AccumulatorGet_)(const swifft_accumulator_t * accumulator,
+	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	size_t i;
+	const ZOvec *zsum = (const ZOvec *)accumulator->sum;
+	ZOvec *zoutput = (ZOvec *)output;
+	size_t size = SWIFFT_OUTPUT_BLOCK_SIZE/sizeof(ZOvec);
+	for (i=0; i<size; i++,zsum++,zoutput++) {
+		*zoutput = SWIFFT_modP(*zsum);
+	}
+}
+
+#define SWIFFT_REDUCE_MULTIPLE_CHUNK 256 ///< Number of blocks per chunk, the unit of parallelization, in reducing multiple blocks into one
+
+//! \brief Multiplies SWIFFT hash values of multiple blocks into a product, element-wise.
+//! The product is kept centered, so that products of its elements never overflow.
+//!
+//! \param[in] nblocks the number of blocks to multiply.
+//! \param[in] operand the hash value to multiply, per block, with elements in the range {0,..,SWIFFT_P-1}.
+//! \param[in,out] product the product to multiply into, with elements in the range {-128,..,128}.
+static inline void SWIFFT_multiply(int nblocks, const BitSequence * LIBSWIFFT_RESTRICT operand,
+	ZOvec * LIBSWIFFT_RESTRICT product)
+{
+	const ZOvec *zoperand = (const ZOvec *)operand;
+	size_t size = SWIFFT_OUTPUT_BLOCK_SIZE/sizeof(ZOvec);
+	size_t j;
+	int i;
+	for (i=0; i<nblocks; i++,zoperand+=size) {
+		for (j=0; j<size; j++) {
+			// a product in {-128*128,..,128*128} is reduced by two qReduce to {-1,..,256}
+			product[j] = SWIFFT_centerP(SWIFFT_qReduce(SWIFFT_qReduce(product[j] * SWIFFT_centerP(zoperand[j]))));
+		}
+	}
+}
+
+//! \brief Sums SWIFFT hash values of multiple blocks, element-wise.
+//! Partial sums are accumulated with lazy reduction, in parallel when built with OpenMP.
+//!
+//! \param[in] nblocks the number of blocks to sum.
+//! \param[in] operand the hash value to sum, per block, with elements in the range {0,..,SWIFFT_P-1}.
+//! \param[out] output the hash value of SWIFFT to set to the sum.
+void SWIFFT_ISET_NAME(SWIFFT_SumMultiple_)(int nblocks, const BitSequence * operand,
+	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	swifft_accumulator_t sum;
+	int nchunks = (nblocks + SWIFFT_REDUCE_MULTIPLE_CHUNK - 1) / SWIFFT_REDUCE_MULTIPLE_CHUNK;
+	SWIFFT_ISET_NAME(SWIFFT_AccumulatorInit_)(&sum);
+#ifdef _OPENMP
+	#pragma omp parallel if(nchunks > 1 && nblocks > SWIFFT_BLOCKS_PARALLELIZATION_THRESHOLD)
+#endif
+	{
+		swifft_accumulator_t partial;
+		SWIFFT_ALIGN BitSequence partialSum[SWIFFT_OUTPUT_BLOCK_SIZE];
+		int i;
+		SWIFFT_ISET_NAME(SWIFFT_AccumulatorInit_)(&partial);
+#ifdef _OPENMP
+		#pragma omp for schedule(static)
+#endif
+		for (i=0; i<nchunks; i++) {
+			int n = nblocks - i * SWIFFT_REDUCE_MULTIPLE_CHUNK;
+			SWIFFT_accumulate(&partial, n < SWIFFT_REDUCE_MULTIPLE_CHUNK ? n : SWIFFT_REDUCE_MULTIPLE_CHUNK,
+				operand + (size_t)i * SWIFFT_REDUCE_MULTIPLE_CHUNK * SWIFFT_OUTPUT_BLOCK_SIZE, 0);
+		}
+		SWIFFT_ISET_NAME(SWIFFT_AccumulatorGet_)(&partial, partialSum);
+#ifdef _OPENMP
+		#pragma omp critical
+#endif
+		SWIFFT_accumulate(&sum, 1, partialSum, 0);
+	}
+	SWIFFT_ISET_NAME(SWIFFT_AccumulatorGet_)(&sum, output);
+}
+
+//! \brief Multiplies SWIFFT hash values of multiple blocks, element-wise.
+//! Partial products are computed in parallel when built with OpenMP.
+//!
+//! \param[in] nblocks the number of blocks to multiply.
+//! \param[in] operand the hash value to multiply, per block, with elements in the range {0,..,SWIFFT_P-1}.
+//! \param[out] output the hash value of SWIFFT to set to the product.
+void SWIFFT_ISET_NAME(SWIFFT_ProductMultiple_)(int nblocks, const BitSequence * operand,
+	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	ZOvec product[SWIFFT_OUTPUT_BLOCK_SIZE/sizeof(ZOvec)];
+	ZOvec *zoutput = (ZOvec *)output;
+	size_t size = SWIFFT_OUTPUT_BLOCK_SIZE/sizeof(ZOvec);
+	size_t j;
+	int nchunks = (nblocks + SWIFFT_REDUCE_MULTIPLE_CHUNK - 1) / SWIFFT_REDUCE_MULTIPLE_CHUNK;
+	for (j=0; j<size; j++) {
+		product[j] = (ZOvec)ZOCONST(1);
+	}
+#ifdef _OPENMP
+	#pragma omp parallel if(nchunks > 1 && nblocks > SWIFFT_BLOCKS_PARALLELIZATION_THRESHOLD)
+#endif
+	{
+		SWIFFT_ALIGN BitSequence partialProduct[SWIFFT_OUTPUT_BLOCK_SIZE];
+		ZOvec *partial = (ZOvec *)partialProduct;
+		size_t k;
+		int i;
+		for (k=0; k<size; k++) {
+			partial[k] = (ZOvec)ZOCONST(1);
+		}
+#ifdef _OPENMP
+		#pragma omp for schedule(static)
+#endif
+		for (i=0; i<nchunks; i++) {
+			int n = nblocks - i * SWIFFT_REDUCE_MULTIPLE_CHUNK;
+			SWIFFT_multiply(n < SWIFFT_REDUCE_MULTIPLE_CHUNK ? n : SWIFFT_REDUCE_MULTIPLE_CHUNK,
+				operand + (size_t)i * SWIFFT_REDUCE_MULTIPLE_CHUNK * SWIFFT_OUTPUT_BLOCK_SIZE, partial);
+		}
+		for (k=0; k<size; k++) {
+			// from {-128,..,128} to {0,..,SWIFFT_P-1}
+			partial[k] = SWIFFT_modP(partial[k]);
+		}
+#ifdef _OPENMP
+		#pragma omp critical
+#endif
+		SWIFFT_multiply(1, partialProduct, product);
+	}
+	for (j=0; j<size; j++) {
+		zoutput[j] = SWIFFT_modP(product[j]);
+	}
+}
+
+//! \brief Computes the result of multiple SWIFFT operations, interleaving SWIFFT_INTERLEAVE blocks at a time.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] m number of 8-elements in each block of input, a compile-time constant of at most SWIFFT_M.
+//! \param[in] input the blocks of input, each of 8*m bytes.
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 8*m bytes.
+//! \param[in] signStride the distance in bytes between blocks of sign bits, 0 for the same sign bits for all blocks.
+//! \param[in] key the SWIFFT key, in the layout for SWIFFT_O (see SWIFFT_PI_keyO).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+static inline void SWIFFT_computeMultiple(int nblocks, int m, const BitSequence * input, const BitSequence * sign,
+	size_t signStride, const int16_t * key, BitSequence * output)
+{
+	int i;
+	int ngroups = nblocks / SWIFFT_INTERLEAVE;
+#ifdef _OPENMP
+	#pragma omp parallel for schedule(static) private(i) if(ngroups > SWIFFT_BLOCKS_PARALLELIZATION_THRESHOLD / SWIFFT_INTERLEAVE)
+#endif
+	for (i=0; i<ngroups; i++) {
+		SWIFFT_computeBlocks(
+			SWIFFT_INTERLEAVE,
+			m,
+			input + (size_t)i * SWIFFT_INTERLEAVE * 8 * m,
+			sign + (size_t)i * SWIFFT_INTERLEAVE * signStride,
+			signStride,
+			key,
+			output + (size_t)i * SWIFFT_INTERLEAVE * SWIFFT_OUTPUT_BLOCK_SIZE
+		);
+	}
+	for (i=ngroups*SWIFFT_INTERLEAVE; i<nblocks; i++) {
+		SWIFFT_computeBlocks(
+			1,
+			m,
+			input + (size_t)i * 8 * m,
+			sign + (size_t)i * signStride,
+			signStride,
+			key,
+			output + (size_t)i * SWIFFT_OUTPUT_BLOCK_SIZE
+		);
+	}
+}
+
+//! \brief Computes the result of multiple SWIFFT operations.
+//! The result is composable with other hash values.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeMultiple_)(int nblocks, const BitSequence * input, BitSequence * output)
+{
+	SWIFFT_computeMultiple(nblocks, SWIFFT_M, input, SWIFFT_sign0, 0, SWIFFT_KEY_O, output);
+}
+
+//! \brief Computes the result of multiple SWIFFT operations.
+//! The result is composable with other hash values.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 256 bytes (2048 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeMultipleSigned_)(int nblocks, const BitSequence * input,
+	const BitSequence * sign, BitSequence * output)
+{
+	SWIFFT_computeMultiple(nblocks, SWIFFT_M, input, sign, SWIFFT_INPUT_BLOCK_SIZE, SWIFFT_KEY_O, output);
+}
+
+//! \brief Computes the result of a SWIFFT operation with a given key.
+//! The result is composable with other hash values computed with the same key.
+//!
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the input of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeKeyed_)(const swifft_key_t * key, const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE],
+	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_compute(input, SWIFFT_sign0, SWIFFT_KEY_LAYOUT_O(key), output);
+}
+
+//! \brief Computes the result of a SWIFFT operation with a given key.
+//! The result is composable with other hash values computed with the same key.
+//!
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the input of 256 bytes (2048 bit).
+//! \param[in] sign the sign bits corresponding to the input of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeSignedKeyed_)(const swifft_key_t * key, const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE],
+	const BitSequence sign[SWIFFT_INPUT_BLOCK_SIZE], BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_compute(input, sign, SWIFFT_KEY_LAYOUT_O(key), output);
+}
+
+//! \brief Computes the result of multiple SWIFFT operations with a given key.
+//! The result is composable with other hash values computed with the same key.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeMultipleKeyed_)(int nblocks, const swifft_key_t * key, const BitSequence * input,
+	BitSequence * output)
+{
+	SWIFFT_computeMultiple(nblocks, SWIFFT_M, input, SWIFFT_sign0, 0, SWIFFT_KEY_LAYOUT_O(key), output);
+}
+
+//! \brief Computes the result of multiple SWIFFT operations with a given key.
+//! The result is composable with other hash values computed with the same key.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 256 bytes (2048 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeMultipleSignedKeyed_)(int nblocks, const swifft_key_t * key, const BitSequence * input,
+	const BitSequence * sign, BitSequence * output)
+{
+	SWIFFT_computeMultiple(nblocks, SWIFFT_M, input, sign, SWIFFT_INPUT_BLOCK_SIZE, SWIFFT_KEY_LAYOUT_O(key), output);
+}
+
+//! \brief Computes the FFT phase of SWIFFT for a block, keeping the FFT-output elements in the parts of
+//! wide SWIFFT vectors as computed by SWIFFT_fftO, rather than transposed.
+//!
+//! \param[in] input the input of 256 bytes (2048 bit).
+//! \param[in] sign the sign bits corresponding to the input of 256 bytes (2048 bit).
+//! \param[in] mode the lookup mode, one of SWIFFT_LOOKUP_*.
+//! \param[out] fft the FFT-output elements, in groups of SWIFFT_O 8-elements.
+static inline void SWIFFT_fftKeepO(const BitSequence * LIBSWIFFT_RESTRICT input, const BitSequence * LIBSWIFFT_RESTRICT sign,
+	int mode, ZOvec fft[SWIFFT_M >> SWIFFT_LOG2_O][8])
+{
+	const Z1vec *Tabl = (const Z1vec *) SWIFFT_fftTable;
+	int i;
+	for (i=0; i<(SWIFFT_M>>SWIFFT_LOG2_O); i++) {
+		SWIFFT_fftO(Tabl, input + 8*SWIFFT_O*i, sign + 8*SWIFFT_O*i, mode, fft[i]);
+	}
+}
+
+//! \brief Computes the results of SWIFFT operations with multiple keys for interleaved blocks.
+//! The FFT phase is computed once per block, and its output, of 4KB per block, stays in the L1 cache
+//! while the FFT-sum phase, as in SWIFFT_fftsumWithLookup, is computed for each key, loading each key
+//! vector once for all blocks.
+//!
+//! \param[in] nb the number of blocks to interleave, a compile-time constant of at most SWIFFT_MAX_INTERLEAVE.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 256 bytes (2048 bit).
+//! \param[in] signStride the distance in bytes between blocks of sign bits, 0 for the same sign bits for all blocks.
+//! \param[in] nkeys the number of keys.
+//! \param[in] keys the SWIFFT keys, initialized using SWIFFT_KeyInit.
+//! \param[out] output the resulting hash values of SWIFFT, for each block those for each key, each of size 128 bytes (1024 bit).
+//! \param[in] mode the lookup mode, one of SWIFFT_LOOKUP_*.
+static inline void SWIFFT_computeMultiKeyWithLookup(int nb, const BitSequence * LIBSWIFFT_RESTRICT input,
+	const BitSequence * LIBSWIFFT_RESTRICT sign, size_t signStride, int nkeys, const swifft_key_t * LIBSWIFFT_RESTRICT keys,
+	BitSequence * LIBSWIFFT_RESTRICT output, int mode)
+{
+	ZOvec fft[nb][SWIFFT_M >> SWIFFT_LOG2_O][8];
+	ZOdvec dacc[nb][8][2];
+	int i,k,b,l;
+	for (b=0; b<nb; b++) {
+		SWIFFT_fftKeepO(input + b*SWIFFT_INPUT_BLOCK_SIZE, sign + b*signStride, mode, fft[b]);
+	}
+	for (l=0; l<nkeys; l++) {
+		const ZOvec *key = (const ZOvec *)SWIFFT_KEY_LAYOUT_O(keys + l);
+		for (b=0; b<nb; b++) {
+			for (k=0; k<8; k++) {
+				dacc[b][k][0] = dacc[b][k][1] = (ZOdvec){0};
+			}
+		}
+		for (i=0; i<(SWIFFT_M>>SWIFFT_LOG2_O); i+=2,key+=16) {
+			for (k=0; k<8; k++) {
+				for (b=0; b<nb; b++) {
+					SWIFFT_maddPairO(dacc[b][k], fft[b][i][k], fft[b][i+1][k], key[k], key[8+k]);
+				}
+			}
+		}
+		for (b=0; b<nb; b++) {
+			SWIFFT_storeSumO(dacc[b], (int16_t *)(output + ((size_t)b*nkeys + l)*SWIFFT_OUTPUT_BLOCK_SIZE));
+		}
+	}
+}
+
+//! \brief Computes the results of SWIFFT operations with multiple keys for interleaved blocks.
+//!
+//! \param[in] nb the number of blocks to interleave, a compile-time constant of at most SWIFFT_MAX_INTERLEAVE.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 256 bytes (2048 bit).
+//! \param[in] signStride the distance in bytes between blocks of sign bits, 0 for the same sign bits for all blocks.
+//! \param[in] nkeys the number of keys.
+//! \param[in] keys the SWIFFT keys, initialized using SWIFFT_KeyInit.
+//! \param[out] output the resulting hash values of SWIFFT, for each block those for each key, each of size 128 bytes (1024 bit).
+static inline void SWIFFT_computeMultiKeyBlocks(int nb, const BitSequence * input, const BitSequence * sign,
+	size_t signStride, int nkeys, const swifft_key_t * keys, BitSequence * output)
+{
+	if (sign == SWIFFT_sign0) {
+		SWIFFT_computeMultiKeyWithLookup(nb, input, sign, signStride, nkeys, keys, output, SWIFFT_LOOKUP_UNSIGNED);
+	} else {
+		SWIFFT_computeMultiKeyWithLookup(nb, input, sign, signStride, nkeys, keys, output, SWIFFT_SIGNED_LOOKUP);
+	}
+}
+
+//! \brief Computes the results of multiple SWIFFT operations with multiple keys.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 256 bytes (2048 bit).
+//! \param[in] signStride the distance in bytes between blocks of sign bits, 0 for the same sign bits for all blocks.
+//! \param[in] nkeys the number of keys.
+//! \param[in] keys the SWIFFT keys, initialized using SWIFFT_KeyInit.
+//! \param[out] output the resulting hash values of SWIFFT, for each block those for each key, each of size 128 bytes (1024 bit).
+static inline void SWIFFT_computeMultipleMultiKey(int nblocks, const BitSequence * input, const BitSequence * sign,
+	size_t signStride, int nkeys, const swifft_key_t * keys, BitSequence * output)
+{
+	int i;
+	int ngroups = nblocks / SWIFFT_INTERLEAVE;
+#ifdef _OPENMP
+	#pragma omp parallel for schedule(static) private(i) if(ngroups > SWIFFT_BLOCKS_PARALLELIZATION_THRESHOLD / SWIFFT_INTERLEAVE)
+#endif
+	for (i=0; i<ngroups; i++) {
+		SWIFFT_computeMultiKeyBlocks(
+			SWIFFT_INTERLEAVE,
+			input + (size_t)i * SWIFFT_INTERLEAVE * SWIFFT_INPUT_BLOCK_SIZE,
+			sign + (size_t)i * SWIFFT_INTERLEAVE * signStride,
+			signStride,
+			nkeys,
+			keys,
+			output + (size_t)i * SWIFFT_INTERLEAVE * nkeys * SWIFFT_OUTPUT_BLOCK_SIZE
+		);
+	}
+	for (i=ngroups*SWIFFT_INTERLEAVE; i<nblocks; i++) {
+		SWIFFT_computeMultiKeyBlocks(
+			1,
+			input + (size_t)i * SWIFFT_INPUT_BLOCK_SIZE,
+			sign + (size_t)i * signStride,
+			signStride,
+			nkeys,
+			keys,
+			output + (size_t)i * nkeys * SWIFFT_OUTPUT_BLOCK_SIZE
+		);
+	}
+}
+
+//! \brief Computes the results of a SWIFFT operation with multiple keys.
+//! The results are the same as of SWIFFT_ComputeKeyed with each key, but the FFT phase is computed once.
+//!
+//! \param[in] nkeys the number of keys.
+//! \param[in] keys the SWIFFT keys, initialized using SWIFFT_KeyInit.
+//! \param[in] input the input of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash values of SWIFFT, one for each key, each of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeMultiKey_)(int nkeys, const swifft_key_t * keys, const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE],
+	BitSequence * output)
+{
+	SWIFFT_computeMultiKeyBlocks(1, input, SWIFFT_sign0, 0, nkeys, keys, output);
+}
+
+//! \brief Computes the results of a SWIFFT operation with multiple keys.
+//! The results are the same as of SWIFFT_ComputeSignedKeyed with each key, but the FFT phase is computed once.
+//!
+//! \param[in] nkeys the number of keys.
+//! \param[in] keys the SWIFFT keys, initialized using SWIFFT_KeyInit.
+//! \param[in] input the input of 256 bytes (2048 bit).
+//! \param[in] sign the sign bits corresponding to the input of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash values of SWIFFT, one for each key, each of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeSignedMultiKey_)(int nkeys, const swifft_key_t * keys, const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE],
+	const BitSequence sign[SWIFFT_INPUT_BLOCK_SIZE], BitSequence * output)
+{
+	SWIFFT_computeMultiKeyBlocks(1, input, sign, 0, nkeys, keys, output);
+}
+
+//! \brief Computes the results of multiple SWIFFT operations with multiple keys.
+//! The results are the same as of SWIFFT_ComputeMultipleKeyed with each key, but the FFT phase is computed
+//! once per block, and the blocks are processed in groups whose FFT-outputs stay in the L1 cache across keys.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] nkeys the number of keys.
+//! \param[in] keys the SWIFFT keys, initialized using SWIFFT_KeyInit.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, for each block of input one for each key, each of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeMultipleMultiKey_)(int nblocks, int nkeys, const swifft_key_t * keys, const BitSequence * input,
+	BitSequence * output)
+{
+	SWIFFT_computeMultipleMultiKey(nblocks, input, SWIFFT_sign0, 0, nkeys, keys, output);
+}
+
+//! \brief Computes the results of multiple SWIFFT operations with multiple keys.
+//! The results are the same as of SWIFFT_ComputeMultipleSignedKeyed with each key, but the FFT phase is computed
+//! once per block, and the blocks are processed in groups whose FFT-outputs stay in the L1 cache across keys.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] nkeys the number of keys.
+//! \param[in] keys the SWIFFT keys, initialized using SWIFFT_KeyInit.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 256 bytes (2048 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, for each block of input one for each key, each of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeMultipleSignedMultiKey_)(int nblocks, int nkeys, const swifft_key_t * keys, const BitSequence * input,
+	const BitSequence * sign, BitSequence * output)
+{
+	SWIFFT_computeMultipleMultiKey(nblocks, input, sign, SWIFFT_INPUT_BLOCK_SIZE, nkeys, keys, output);
+}
+
+//! Number of ChaCha20 blocks computed at once, one per 32-bit element of a native vector
+#define SWIFFT_CHACHA_BLOCKS (SWIFFT_VECTOR_SIZE/2)
+//! Number of 16-bit words in SWIFFT_CHACHA_BLOCKS blocks of ChaCha20 keystream
+#define SWIFFT_CHACHA_WORDS (SWIFFT_CHACHA_BLOCKS*32)
+
+//! \brief Rotates left each element of a native vector of unsigned 32-bit elements.
+#define SWIFFT_ROTLV(x, n) (((x) << (n)) | ((x) >> (32 - (n))))
+
+//! \brief Computes a quarter-round of ChaCha20 on native vectors of unsigned 32-bit elements.
+#define SWIFFT_CHACHA_QUARTER_ROUND(a, b, c, d) \
+	a += b; d = SWIFFT_ROTLV(d ^ a, 16); \
+	c += d; b = SWIFFT_ROTLV(b ^ c, 12); \
+	a += b; d = SWIFFT_ROTLV(d ^ a, 8); \
+	c += d; b = SWIFFT_ROTLV(b ^ c, 7)
+
+//! \brief Computes consecutive blocks of the ChaCha20 keystream, as specified in RFC 8439, with a zero nonce.
+//! The blocks are computed at once, each in an element of native vectors, and are then written one after
+//! the other as little-endian 16-bit words.
+//!
+//! \param[in] seed the 256-bit key of ChaCha20.
+//! \param[in] counter the block counter of the first block.
+//! \param[out] words the keystream of SWIFFT_CHACHA_BLOCKS blocks, each of 32 16-bit words.
+static inline void SWIFFT_chachaBlocks(const BitSequence seed[SWIFFT_KEY_SEED_SIZE], uint32_t counter,
+	int16_t words[SWIFFT_CHACHA_WORDS])
+{
+	static const uint32_t sigma[4] = {0x61707865, 0x3320646e, 0x79622d32, 0x6b206574};
+	const ZVuvec ZU_0 = ZVDCONST(0), indices = ZVDINDICES;
+	ZVuvec s[16], x[16];
+	int i, j;
+	for (i=0; i<4; i++) {
+		s[i] = ZU_0 + sigma[i];
+	}
+	for (i=0; i<8; i++) {
+		s[4+i] = ZU_0 + (seed[4*i] | ((uint32_t)seed[4*i+1] << 8) | ((uint32_t)seed[4*i+2] << 16) | ((uint32_t)seed[4*i+3] << 24));
+	}
+	s[12] = indices + counter;
+	s[13] = s[14] = s[15] = ZU_0;
+	for (i=0; i<16; i++) {
+		x[i] = s[i];
+	}
+	for (i=0; i<10; i++) {
+		SWIFFT_CHACHA_QUARTER_ROUND(x[0], x[4], x[8], x[12]);
+		SWIFFT_CHACHA_QUARTER_ROUND(x[1], x[5], x[9], x[13]);
+		SWIFFT_CHACHA_QUARTER_ROUND(x[2], x[6], x[10], x[14]);
+		SWIFFT_CHACHA_QUARTER_ROUND(x[3], x[7], x[11], x[15]);
+		SWIFFT_CHACHA_QUARTER_ROUND(x[0], x[5], x[10], x[15]);
+		SWIFFT_CHACHA_QUARTER_ROUND(x[1], x[6], x[11], x[12]);
+		SWIFFT_CHACHA_QUARTER_ROUND(x[2], x[7], x[8], x[13]);
+		SWIFFT_CHACHA_QUARTER_ROUND(x[3], x[4], x[9], x[14]);
+	}
+	for (i=0; i<16; i++) {
+		x[i] += s[i];
+		for (j=0; j<SWIFFT_CHACHA_BLOCKS; j++) {
+			uint32_t word = x[i][j];
+			memcpy(words + 2*(16*j+i), &word, sizeof(word));
+		}
+	}
+}
+
+//! \brief Samples elements of Z_{257} from 16-bit words by rejection, centered to {-128,..,128}.
+//! The word 65535 is rejected and any other word w is sampled as w mod 257, which is uniform since
+//! each element is sampled from 255 words. Words are sampled a wide SWIFFT vector at a time, as
+//! rejection is rare.
+//!
+//! \param[in] words the words to sample from.
+//! \param[out] values the sampled elements.
+//! \returns the number of sampled elements.
+static inline int SWIFFT_sampleKey(const int16_t words[SWIFFT_CHACHA_WORDS], int16_t * values)
+{
+	const ZOvec *w = (const ZOvec *)words;
+	ZOvec ZO_255 = ZOCONST(255), ZO_M1 = ZOCONST(-1);
+	int i, j, n = 0;
+	for (i=0; i<SWIFFT_CHACHA_WORDS/(SWIFFT_O*SWIFFT_W); i++) {
+		// w = 256*hi + lo is congruent to lo - hi, which is in {-255,..,255}
+		ZOvec v = SWIFFT_centerP((w[i] & ZO_255) - ((w[i] >> 8) & ZO_255));
+		if (SWIFFT_isZeroO(w[i] == ZO_M1)) {
+			memcpy(values + n, &v, sizeof(v));
+			n += SWIFFT_O*SWIFFT_W;
+		} else {
+			for (j=0; j<SWIFFT_O*SWIFFT_W; j++) {
+				if (w[i][j] != -1) {
+					values[n++] = v[j];
+				}
+			}
+		}
+	}
+	return n;
+}
+
+//! \brief Derives a SWIFFT key from a seed.
+//! The elements of the key are sampled uniformly by rejection from the 16-bit little-endian words of the
+//! ChaCha20 keystream, as specified in RFC 8439, keyed by the seed with a zero nonce and a block counter
+//! starting at 0. A word w other than 65535 is sampled as the element w mod 257, in the order of SWIFFT_KeyInit.
+//! The derived key is the same for all instruction-sets.
+//!
+//! \param[in] seed the seed of 32 bytes (256 bit).
+//! \param[out] key the SWIFFT key to derive.
+void SWIFFT_ISET_NAME(SWIFFT_DeriveKey_)(const BitSequence seed[SWIFFT_KEY_SEED_SIZE], swifft_key_t * key)
+{
+	SWIFFT_ALIGN int16_t words[SWIFFT_CHACHA_WORDS];
+	SWIFFT_ALIGN int16_t values[SWIFFT_KEY_SIZE + SWIFFT_CHACHA_WORDS];
+	uint32_t counter;
+	int n = 0;
+	for (counter=0; n<SWIFFT_KEY_SIZE; counter+=SWIFFT_CHACHA_BLOCKS) {
+		SWIFFT_chachaBlocks(seed, counter, words);
+		n += SWIFFT_sampleKey(words, values + n);
+	}
+	SWIFFT_KeyInit(key, values);
+}
+
+//! \brief Computes the result of a SWIFFT operation on a short input.
+//! The result is the same as for the input padded with zeros to 256 bytes.
+//!
+//! \param[in] input the input of 128 bytes (1024 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_Compute128_)(const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE_128],
+	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_computeBlocks(1, SWIFFT_M/2, input, SWIFFT_sign0, 0, SWIFFT_KEY_O, output);
+}
+
+//! \brief Computes the result of a SWIFFT operation on a short input.
+//! The result is the same as for the input and sign bits padded with zeros to 256 bytes.
+//!
+//! \param[in] input the input of 128 bytes (1024 bit).
+//! \param[in] sign the sign bits corresponding to the input of 128 bytes (1024 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeSigned128_)(const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE_128],
+	const BitSequence sign[SWIFFT_INPUT_BLOCK_SIZE_128],
+	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_computeBlocks(1, SWIFFT_M/2, input, sign, 0, SWIFFT_KEY_O, output);
+}
+
+//! \brief Computes the result of multiple SWIFFT operations on short inputs.
+//! The result is the same as for the inputs padded with zeros to 256 bytes.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] input the blocks of input, each of 128 bytes (1024 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeMultiple128_)(int nblocks, const BitSequence * input, BitSequence * output)
+{
+	SWIFFT_computeMultiple(nblocks, SWIFFT_M/2, input, SWIFFT_sign0, 0, SWIFFT_KEY_O, output);
+}
+
+//! \brief Computes the result of multiple SWIFFT operations on short inputs.
+//! The result is the same as for the inputs and sign bits padded with zeros to 256 bytes.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] input the blocks of input, each of 128 bytes (1024 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 128 bytes (1024 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeMultipleSigned128_)(int nblocks, const BitSequence * input,
+	const BitSequence * sign, BitSequence * output)
+{
+	SWIFFT_computeMultiple(nblocks, SWIFFT_M/2, input, sign, SWIFFT_INPUT_BLOCK_SIZE_128, SWIFFT_KEY_O, output);
+}
+
+//! \brief Computes the result of a SWIFFT operation on a short input.
+//! The result is the same as for the input padded with zeros to 256 bytes.
+//!
+//! \param[in] input the input of 64 bytes (512 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_Compute64_)(const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE_64],
+	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_computeBlocks(1, SWIFFT_M/4, input, SWIFFT_sign0, 0, SWIFFT_KEY_O, output);
+}
+
+//! \brief Computes the result of a SWIFFT operation on a short input.
+//! The result is the same as for the input and sign bits padded with zeros to 256 bytes.
+//!
+//! \param[in] input the input of 64 bytes (512 bit).
+//! \param[in] sign the sign bits corresponding to the input of 64 bytes (512 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeSigned64_)(const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE_64],
+	const BitSequence sign[SWIFFT_INPUT_BLOCK_SIZE_64],
+	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_computeBlocks(1, SWIFFT_M/4, input, sign, 0, SWIFFT_KEY_O, output);
+}
+
+//! \brief Computes the result of multiple SWIFFT operations on short inputs.
+//! The result is the same as for the inputs padded with zeros to 256 bytes.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] input the blocks of input, each of 64 bytes (512 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeMultiple64_)(int nblocks, const BitSequence * input, BitSequence * output)
+{
+	SWIFFT_computeMultiple(nblocks, SWIFFT_M/4, input, SWIFFT_sign0, 0, SWIFFT_KEY_O, output);
+}
+
+//! \brief Computes the result of multiple SWIFFT operations on short inputs.
+//! The result is the same as for the inputs and sign bits padded with zeros to 256 bytes.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] input the blocks of input, each of 64 bytes (512 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 64 bytes (512 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeMultipleSigned64_)(int nblocks, const BitSequence * input,
+	const BitSequence * sign, BitSequence * output)
+{
+	SWIFFT_computeMultiple(nblocks, SWIFFT_M/4, input, sign, SWIFFT_INPUT_BLOCK_SIZE_64, SWIFFT_KEY_O, output);
+}
+
+//! \brief Computes the result of a SWIFFT operation on a short input with a given key.
+//! The result is the same as of SWIFFT_ComputeKeyed for the input padded with zeros to 256 bytes.
+//!
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the input of 128 bytes (1024 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_Compute128Keyed_)(const swifft_key_t * key, const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE_128],
+	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_computeBlocks(1, SWIFFT_M/2, input, SWIFFT_sign0, 0, SWIFFT_KEY_LAYOUT_O(key), output);
+}
+
+//! \brief Computes the result of a SWIFFT operation on a short input with a given key.
+//! The result is the same as of SWIFFT_ComputeSignedKeyed for the input padded with zeros to 256 bytes.
+//!
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the input of 128 bytes (1024 bit).
+//! \param[in] sign the sign bits corresponding to the input of 128 bytes (1024 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeSigned128Keyed_)(const swifft_key_t * key, const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE_128],
+	const BitSequence sign[SWIFFT_INPUT_BLOCK_SIZE_128], BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_computeBlocks(1, SWIFFT_M/2, input, sign, 0, SWIFFT_KEY_LAYOUT_O(key), output);
+}
+
+//! \brief Computes the result of multiple SWIFFT operations on short inputs with a given key.
+//! The result is the same as of SWIFFT_ComputeMultipleKeyed for the inputs padded with zeros to 256 bytes.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the blocks of input, each of 128 bytes (1024 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeMultiple128Keyed_)(int nblocks, const swifft_key_t * key, const BitSequence * input,
+	BitSequence * output)
+{
+	SWIFFT_computeMultiple(nblocks, SWIFFT_M/2, input, SWIFFT_sign0, 0, SWIFFT_KEY_LAYOUT_O(key), output);
+}
+
+//! \brief Computes the result of multiple SWIFFT operations on short inputs with a given key.
+//! The result is the same as of SWIFFT_ComputeMultipleSignedKeyed for the inputs padded with zeros to 256 bytes.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the blocks of input, each of 128 bytes (1024 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 128 bytes (1024 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeMultipleSigned128Keyed_)(int nblocks, const swifft_key_t * key, const BitSequence * input,
+	const BitSequence * sign, BitSequence * output)
+{
+	SWIFFT_computeMultiple(nblocks, SWIFFT_M/2, input, sign, SWIFFT_INPUT_BLOCK_SIZE_128, SWIFFT_KEY_LAYOUT_O(key), output);
+}
+
+//! \brief Computes the result of a SWIFFT operation on a short input with a given key.
+//! The result is the same as of SWIFFT_ComputeKeyed for the input padded with zeros to 256 bytes.
+//!
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the input of 64 bytes (512 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_Compute64Keyed_)(const swifft_key_t * key, const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE_64],
+	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_computeBlocks(1, SWIFFT_M/4, input, SWIFFT_sign0, 0, SWIFFT_KEY_LAYOUT_O(key), output);
+}
+
+//! \brief Computes the result of a SWIFFT operation on a short input with a given key.
+//! The result is the same as of SWIFFT_ComputeSignedKeyed for the input padded with zeros to 256 bytes.
+//!
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the input of 64 bytes (512 bit).
+//! \param[in] sign the sign bits corresponding to the input of 64 bytes (512 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeSigned64Keyed_)(const swifft_key_t * key, const BitSequence input[SWIFFT_INPUT_BLOCK_SIZE_64],
+	const BitSequence sign[SWIFFT_INPUT_BLOCK_SIZE_64], BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_computeBlocks(1, SWIFFT_M/4, input, sign, 0, SWIFFT_KEY_LAYOUT_O(key), output);
+}
+
+//! \brief Computes the result of multiple SWIFFT operations on short inputs with a given key.
+//! The result is the same as of SWIFFT_ComputeMultipleKeyed for the inputs padded with zeros to 256 bytes.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the blocks of input, each of 64 bytes (512 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeMultiple64Keyed_)(int nblocks, const swifft_key_t * key, const BitSequence * input,
+	BitSequence * output)
+{
+	SWIFFT_computeMultiple(nblocks, SWIFFT_M/4, input, SWIFFT_sign0, 0, SWIFFT_KEY_LAYOUT_O(key), output);
+}
+
+//! \brief Computes the result of multiple SWIFFT operations on short inputs with a given key.
+//! The result is the same as of SWIFFT_ComputeMultipleSignedKeyed for the inputs padded with zeros to 256 bytes.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the blocks of input, each of 64 bytes (512 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 64 bytes (512 bit).
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeMultipleSigned64Keyed_)(int nblocks, const swifft_key_t * key, const BitSequence * input,
+	const BitSequence * sign, BitSequence * output)
+{
+	SWIFFT_computeMultiple(nblocks, SWIFFT_M/4, input, sign, SWIFFT_INPUT_BLOCK_SIZE_64, SWIFFT_KEY_LAYOUT_O(key), output);
+}
+
+#define SWIFFT_COMPUTE_SUM_REDUCE_INTERVAL 64 ///< Number of blocks whose FFT-output elements are summed into 16-bit elements between reductions
+
+//! \brief Sums the FFT phase of SWIFFT for multiple blocks.
+//! The FFT-output elements, in the range {-127,..,383}, are summed in the layout of SWIFFT_fftO
+//! without transposing and are reduced every SWIFFT_COMPUTE_SUM_REDUCE_INTERVAL blocks, which cannot overflow.
+//!
+//! \param[in] nblocks the number of blocks to sum.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 256 bytes (2048 bit).
+//! \param[in] signStride the distance in bytes between blocks of sign bits, 0 for the same sign bits for all blocks.
+//! \param[in] mode the lookup mode, one of SWIFFT_LOOKUP_*.
+//! \param[in,out] fftsum the sums of FFT-output elements to add to, in the range {-127,..,383}.
+static inline void SWIFFT_fftAccumulate(int nblocks, const BitSequence * LIBSWIFFT_RESTRICT input,
+	const BitSequence * LIBSWIFFT_RESTRICT sign, size_t signStride, int mode,
+	ZOvec fftsum[SWIFFT_M >> SWIFFT_LOG2_O][8])
+{
+	int b,i,k;
+	const Z1vec *Tabl = (const Z1vec *) SWIFFT_fftTable;
+	ZOvec v[8];
+
+	for (b=0; b<nblocks; b++) {
+		const BitSequence *t = input + (size_t)b * SWIFFT_INPUT_BLOCK_SIZE;
+		const BitSequence *u = sign + (size_t)b * signStride;
+		for (i=0; i<(SWIFFT_M>>SWIFFT_LOG2_O); i++,t+=8*SWIFFT_O,u+=8*SWIFFT_O) {
+			SWIFFT_fftO(Tabl, t, u, mode, v);
+			for (k=0; k<8; k++) {
+				fftsum[i][k] += v[k];
+			}
+		}
+		if ((b+1) % SWIFFT_COMPUTE_SUM_REDUCE_INTERVAL == 0 || b+1 == nblocks) {
+			for (i=0; i<(SWIFFT_M>>SWIFFT_LOG2_O); i++) {
+				for (k=0; k<8; k++) {
+					fftsum[i][k] = SWIFFT_qReduce(fftsum[i][k]);
+				}
+			}
+		}
+	}
+}
+
+//! \brief Sums the FFT phase of SWIFFT for multiple blocks weighted by coefficients.
+//! Pairs of blocks are multiplied-and-added into 32-bit elements, each pair contributing at most
+//! 2*128*383 in absolute value, so up to 2^15 blocks cannot overflow, and are reduced once.
+//!
+//! \param[in] nblocks the number of blocks to sum, at most 2^15.
+//! \param[in] coeffs the coefficients of the blocks.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 256 bytes (2048 bit).
+//! \param[in] signStride the distance in bytes between blocks of sign bits, 0 for the same sign bits for all blocks.
+//! \param[in] mode the lookup mode, one of SWIFFT_LOOKUP_*.
+//! \param[in,out] fftsum the sums of FFT-output elements to add to, in the range {-127,..,383}.
+static inline void SWIFFT_fftAccumulateWeighted(int nblocks, const int16_t * LIBSWIFFT_RESTRICT coeffs,
+	const BitSequence * LIBSWIFFT_RESTRICT input, const BitSequence * LIBSWIFFT_RESTRICT sign,
+	size_t signStride, int mode, ZOvec fftsum[SWIFFT_M >> SWIFFT_LOG2_O][8])
+{
+	int b,i,k;
+	const Z1vec *Tabl = (const Z1vec *) SWIFFT_fftTable;
+	ZOvec v[2][8];
+	ZOdvec dacc[SWIFFT_M >> SWIFFT_LOG2_O][8][2];
+
+	for (i=0; i<(SWIFFT_M>>SWIFFT_LOG2_O); i++) {
+		for (k=0; k<8; k++) {
+			dacc[i][k][0] = dacc[i][k][1] = (ZOdvec)ZDCONST(0);
+		}
+	}
+	for (b=0; b<nblocks; b+=2) {
+		// the last block of an odd number of blocks is paired with a zero-weighted copy of itself
+		const int b1 = (b+1 < nblocks) ? b+1 : b;
+		const BitSequence *t0 = input + (size_t)b * SWIFFT_INPUT_BLOCK_SIZE;
+		const BitSequence *u0 = sign + (size_t)b * signStride;
+		const BitSequence *t1 = input + (size_t)b1 * SWIFFT_INPUT_BLOCK_SIZE;
+		const BitSequence *u1 = sign + (size_t)b1 * signStride;
+		const ZOvec c0 = ZOCONST(SWIFFT_centerCoefficient(coeffs[b]));
+		const ZOvec c1 = ZOCONST((b1 != b) ? SWIFFT_centerCoefficient(coeffs[b1]) : 0);
+		for (i=0; i<(SWIFFT_M>>SWIFFT_LOG2_O); i++) {
+			SWIFFT_fftO(Tabl, t0 + i*8*SWIFFT_O, u0 + i*8*SWIFFT_O, mode, v[0]);
+			SWIFFT_fftO(Tabl, t1 + i*8*SWIFFT_O, u1 + i*8*SWIFFT_O, mode, v[1]);
+			for (k=0; k<8; k++) {
+				SWIFFT_maddPairO(dacc[i][k], v[0][k], v[1][k], c0, c1);
+			}
+		}
+	}
+	for (i=0; i<(SWIFFT_M>>SWIFFT_LOG2_O); i++) {
+		for (k=0; k<8; k++) {
+			fftsum[i][k] = SWIFFT_qReduce(fftsum[i][k] + SWIFFT_packReduce(dacc[i][k]));
+		}
+	}
+}
+
+//! \brief Sums the FFT phase of SWIFFT for multiple blocks, looking up the FFT table in the mode for the sign.
+//!
+//! \param[in] nblocks the number of blocks to sum.
+//! \param[in] coeffs the coefficients of the blocks, or NULL for a coefficient of 1 for each block.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 256 bytes (2048 bit).
+//! \param[in] signStride the distance in bytes between blocks of sign bits, 0 for the same sign bits for all blocks.
+//! \param[in,out] fftsum the sums of FFT-output elements to add to, in the range {-127,..,383}.
+static inline void SWIFFT_fftAccumulateWithSign(int nblocks, const int16_t * LIBSWIFFT_RESTRICT coeffs,
+	const BitSequence * LIBSWIFFT_RESTRICT input, const BitSequence * LIBSWIFFT_RESTRICT sign,
+	size_t signStride, ZOvec fftsum[SWIFFT_M >> SWIFFT_LOG2_O][8])
+{
+	int mode = (sign == SWIFFT_sign0) ? SWIFFT_LOOKUP_UNSIGNED : SWIFFT_SIGNED_LOOKUP;
+	// instantiating the kernels with a constant lookup mode
+	if (coeffs) {
+		if (mode == SWIFFT_LOOKUP_UNSIGNED) {
+			SWIFFT_fftAccumulateWeighted(nblocks, coeffs, input, sign, signStride, SWIFFT_LOOKUP_UNSIGNED, fftsum);
+		} else {
+			SWIFFT_fftAccumulateWeighted(nblocks, coeffs, input, sign, signStride, SWIFFT_SIGNED_LOOKUP, fftsum);
+		}
+	} else {
+		if (mode == SWIFFT_LOOKUP_UNSIGNED) {
+			SWIFFT_fftAccumulate(nblocks, input, sign, signStride, SWIFFT_LOOKUP_UNSIGNED, fftsum);
+		} else {
+			SWIFFT_fftAccumulate(nblocks, input, sign, signStride, SWIFFT_SIGNED_LOOKUP, fftsum);
+		}
+	}
+}
+
+//! \brief Computes the sum of the results of SWIFFT operations for multiple blocks, optionally weighted by coefficients.
+//! Since the FFT-sum phase is linear in the FFT-output elements, the FFT-output elements of all blocks are
+//! summed first, in parallel when built with OpenMP, and the FFT-sum phase is computed once for the sum.
+//!
+//! \param[in] nblocks the number of blocks to sum.
+//! \param[in] coeffs the coefficients of the blocks, or NULL for a coefficient of 1 for each block.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 256 bytes (2048 bit).
+//! \param[in] signStride the distance in bytes between blocks of sign bits, 0 for the same sign bits for all blocks.
+//! \param[in] ikey the SWIFFT key, in the layout for SWIFFT_O (see SWIFFT_PI_keyO).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+static inline void SWIFFT_computeSum(int nblocks, const int16_t * coeffs, const BitSequence * input,
+	const BitSequence * sign, size_t signStride, const int16_t * ikey, BitSequence * output)
+{
+	const ZOvec *key = (const ZOvec *)ikey;
+	ZOvec fftsum[SWIFFT_M >> SWIFFT_LOG2_O][8];
+	ZOdvec dacc[8][2];
+	int nchunks = (nblocks + SWIFFT_REDUCE_MULTIPLE_CHUNK - 1) / SWIFFT_REDUCE_MULTIPLE_CHUNK;
+	int i,k;
+	for (i=0; i<(SWIFFT_M>>SWIFFT_LOG2_O); i++) {
+		for (k=0; k<8; k++) {
+			fftsum[i][k] = (ZOvec)ZOCONST(0);
+		}
+	}
+#ifdef _OPENMP
+	#pragma omp parallel if(nchunks > 1 && nblocks > SWIFFT_BLOCKS_PARALLELIZATION_THRESHOLD)
+#endif
+	{
+		ZOvec partial[SWIFFT_M >> SWIFFT_LOG2_O][8];
+		int j,l;
+		for (j=0; j<(SWIFFT_M>>SWIFFT_LOG2_O); j++) {
+			for (l=0; l<8; l++) {
+				partial[j][l] = (ZOvec)ZOCONST(0);
+			}
+		}
+#ifdef _OPENMP
+		#pragma omp for schedule(static)
+#endif
+		for (j=0; j<nchunks; j++) {
+			int n = nblocks - j * SWIFFT_REDUCE_MULTIPLE_CHUNK;
+			SWIFFT_fftAccumulateWithSign(n < SWIFFT_REDUCE_MULTIPLE_CHUNK ? n : SWIFFT_REDUCE_MULTIPLE_CHUNK,
+				coeffs ? coeffs + (size_t)j * SWIFFT_REDUCE_MULTIPLE_CHUNK : NULL,
+				input + (size_t)j * SWIFFT_REDUCE_MULTIPLE_CHUNK * SWIFFT_INPUT_BLOCK_SIZE,
+				sign + (size_t)j * SWIFFT_REDUCE_MULTIPLE_CHUNK * signStride,
+				signStride, partial);
+		}
+#ifdef _OPENMP
+		#pragma omp critical
+#endif
+		for (j=0; j<(SWIFFT_M>>SWIFFT_LOG2_O); j++) {
+			for (l=0; l<8; l++) {
+				fftsum[j][l] = SWIFFT_qReduce(fftsum[j][l] + partial[j][l]);
+			}
+		}
+	}
+	// the FFT-sum phase, as in SWIFFT_fftsumWithLookup, over the summed FFT-output elements
+	for (k=0; k<8; k++) {
+		dacc[k][0] = dacc[k][1] = (ZOdvec){0};
+	}
+	for (i=0; i<(SWIFFT_M>>SWIFFT_LOG2_O); i+=2,key+=16) {
+		for (k=0; k<8; k++) {
+			SWIFFT_maddPairO(dacc[k], fftsum[i][k], fftsum[i+1][k], key[k], key[8+k]);
+		}
+	}
+	SWIFFT_storeSumO(dacc, (int16_t *)output);
+}
+
+//! \brief Computes the sum of the results of SWIFFT operations for multiple blocks.
+//! The result is the same as summing the results of SWIFFT_ComputeMultiple, but faster.
+//!
+//! \param[in] nblocks the number of blocks to sum.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeSum_)(int nblocks, const BitSequence * input,
+	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_computeSum(nblocks, NULL, input, SWIFFT_sign0, 0, SWIFFT_KEY_O, output);
+}
+
+//! \brief Computes the sum of the results of SWIFFT operations for multiple blocks.
+//! The result is the same as summing the results of SWIFFT_ComputeMultipleSigned, but faster.
+//!
+//! \param[in] nblocks the number of blocks to sum.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeSumSigned_)(int nblocks, const BitSequence * input,
+	const BitSequence * sign, BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_computeSum(nblocks, NULL, input, sign, SWIFFT_INPUT_BLOCK_SIZE, SWIFFT_KEY_O, output);
+}
+
+//! \brief Computes a linear combination of the results of SWIFFT operations for multiple blocks.
+//! The result is the same as SWIFFT_LinearCombination of the results of SWIFFT_ComputeMultiple, but faster.
+//!
+//! \param[in] nblocks the number of blocks to combine.
+//! \param[in] coeffs the coefficients of the blocks.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeLinearCombination_)(int nblocks, const int16_t * coeffs,
+	const BitSequence * input, BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_computeSum(nblocks, coeffs, input, SWIFFT_sign0, 0, SWIFFT_KEY_O, output);
+}
+
+//! \brief Computes a linear combination of the results of SWIFFT operations for multiple blocks.
+//! The result is the same as SWIFFT_LinearCombination of the results of SWIFFT_ComputeMultipleSigned, but faster.
+//!
+//! \param[in] nblocks the number of blocks to combine.
+//! \param[in] coeffs the coefficients of the blocks.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeLinearCombinationSigned_)(int nblocks, const int16_t * coeffs,
+	const BitSequence * input, const BitSequence * sign, BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_computeSum(nblocks, coeffs, input, sign, SWIFFT_INPUT_BLOCK_SIZE, SWIFFT_KEY_O, output);
+}
+
+//! \brief Computes the sum of the results of SWIFFT operations with a given key for multiple blocks.
+//! The result is the same as summing the results of SWIFFT_ComputeMultipleKeyed, but faster.
+//!
+//! \param[in] nblocks the number of blocks to sum.
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeSumKeyed_)(int nblocks, const swifft_key_t * key, const BitSequence * input,
+	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_computeSum(nblocks, NULL, input, SWIFFT_sign0, 0, SWIFFT_KEY_LAYOUT_O(key), output);
+}
+
+//! \brief Computes the sum of the results of SWIFFT operations with a given key for multiple blocks.
+//! The result is the same as summing the results of SWIFFT_ComputeMultipleSignedKeyed, but faster.
+//!
+//! \param[in] nblocks the number of blocks to sum.
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeSumSignedKeyed_)(int nblocks, const swifft_key_t * key, const BitSequence * input,
+	const BitSequence * sign, BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_computeSum(nblocks, NULL, input, sign, SWIFFT_INPUT_BLOCK_SIZE, SWIFFT_KEY_LAYOUT_O(key), output);
+}
+
+//! \brief Computes a linear combination of the results of SWIFFT operations with a given key for multiple blocks.
+//! The result is the same as SWIFFT_LinearCombination of the results of SWIFFT_ComputeMultipleKeyed, but faster.
+//!
+//! \param[in] nblocks the number of blocks to combine.
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] coeffs the coefficients of the blocks.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeLinearCombinationKeyed_)(int nblocks, const swifft_key_t * key, const int16_t * coeffs,
+	const BitSequence * input, BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_computeSum(nblocks, coeffs, input, SWIFFT_sign0, 0, SWIFFT_KEY_LAYOUT_O(key), output);
+}
+
+//! \brief Computes a linear combination of the results of SWIFFT operations with a given key for multiple blocks.
+//! The result is the same as SWIFFT_LinearCombination of the results of SWIFFT_ComputeMultipleSignedKeyed, but faster.
+//!
+//! \param[in] nblocks the number of blocks to combine.
+//! \param[in] key the SWIFFT key, initialized using SWIFFT_KeyInit.
+//! \param[in] coeffs the coefficients of the blocks.
+//! \param[in] input the blocks of input, each of 256 bytes (2048 bit).
+//! \param[in] sign the blocks of sign bits corresponding to blocks of input of 256 bytes (2048 bit).
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeLinearCombinationSignedKeyed_)(int nblocks, const swifft_key_t * key, const int16_t * coeffs,
+	const BitSequence * input, const BitSequence * sign, BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_computeSum(nblocks, coeffs, input, sign, SWIFFT_INPUT_BLOCK_SIZE, SWIFFT_KEY_LAYOUT_O(key), output);
+}
+
+//! Number of changed input bits whose contributions can be summed in 16 bits before reducing
+#define SWIFFT_UPDATE_BITS_REDUCE_INTERVAL 64
+
+//! \brief Returns the value of an input bit with its sign bit.
+//!
+//! \param[in] input the input of 256 bytes (2048 bit).
+//! \param[in] sign the sign bits corresponding to the input of 256 bytes (2048 bit).
+//! \param[in] position the position of the input bit, for bit position&7 of byte position>>3.
+//! \returns the value of the input bit, in {-1,0,1}.
+static inline int SWIFFT_bitValue(const BitSequence * input, const BitSequence * sign, int position)
+{
+	int t = (input[position >> 3] >> (position & 7)) & 1;
+	int u = (sign[position >> 3] >> (position & 7)) & 1;
+	return t - 2*(t & u);
+}
+
+//! \brief Updates the result of a SWIFFT operation for a change of some input bits or their sign bits.
+//! Since the hash value is linear in the input bits, the contribution of each changed bit,
+//! from SWIFFT_bitTable, is added times the change in its value.
+//!
+//! \param[in,out] output the hash value of SWIFFT of the old input, of size 128 bytes (1024 bit), to update to that of the new input.
+//! \param[in] npositions the number of positions of input bits to update.
+//! \param[in] positions the distinct positions of the input bits that may have changed.
+//! \param[in] oldInput the old input of 256 bytes (2048 bit).
+//! \param[in] oldSign the sign bits corresponding to the old input of 256 bytes (2048 bit).
+//! \param[in] newInput the new input of 256 bytes (2048 bit).
+//! \param[in] newSign the sign bits corresponding to the new input of 256 bytes (2048 bit).
+static inline void SWIFFT_updateBits(BitSequence * output, int npositions, const int * positions,
+	const BitSequence * oldInput, const BitSequence * oldSign, const BitSequence * newInput, const BitSequence * newSign)
+{
+	int i,j,n=0;
+	ZOvec *out = (ZOvec *)output;
+	ZOvec acc[8 >> SWIFFT_LOG2_O];
+
+	for (j=0; j<(8>>SWIFFT_LOG2_O); j++) {
+		acc[j] = out[j];
+	}
+	for (i=0; i<npositions; i++) {
+		int p = positions[i];
+		int d = SWIFFT_bitValue(newInput, newSign, p) - SWIFFT_bitValue(oldInput, oldSign, p);
+		if (d == 0) {
+			continue;
+		}
+		// each contribution is in {-128,..,128} and each change in {-2,..,2}
+		const ZOvec *contrib = (const ZOvec *)(SWIFFT_bitTable + (size_t)p*SWIFFT_N);
+		ZOvec zd = ZOCONST((int16_t)d);
+		for (j=0; j<(8>>SWIFFT_LOG2_O); j++) {
+			acc[j] += zd * contrib[j];
+		}
+		if (++n == SWIFFT_UPDATE_BITS_REDUCE_INTERVAL) {
+			for (j=0; j<(8>>SWIFFT_LOG2_O); j++) {
+				acc[j] = SWIFFT_qReduce(acc[j]);
+			}
+			n = 0;
+		}
+	}
+	for (j=0; j<(8>>SWIFFT_LOG2_O); j++) {
+		out[j] = SWIFFT_modP(acc[j]);
+	}
+}
+
+//! \brief Updates the results of multiple SWIFFT operations for a change of some input bits or their sign bits.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the blocks of hash values of SWIFFT of the old inputs, each of size 128 bytes (1024 bit), to update to those of the new inputs.
+//! \param[in] npositions the number of positions of input bits to update in each block.
+//! \param[in] positions the distinct positions of the input bits that may have changed in each block.
+//! \param[in] oldInput the blocks of old input, each of 256 bytes (2048 bit).
+//! \param[in] oldSign the blocks of sign bits corresponding to blocks of old input of 256 bytes (2048 bit).
+//! \param[in] newInput the blocks of new input, each of 256 bytes (2048 bit).
+//! \param[in] newSign the blocks of sign bits corresponding to blocks of new input of 256 bytes (2048 bit).
+//! \param[in] signStride the distance in bytes between blocks of sign bits, 0 for the same sign bits for all blocks.
+static inline void SWIFFT_updateBitsMultiple(int nblocks, BitSequence * output, int npositions, const int * positions,
+	const BitSequence * oldInput, const BitSequence * oldSign, const BitSequence * newInput, const BitSequence * newSign,
+	size_t signStride)
+{
+	int i;
+#ifdef _OPENMP
+	#pragma omp parallel for schedule(static) private(i) if(nblocks > SWIFFT_BLOCKS_PARALLELIZATION_THRESHOLD)
+#endif
+	for (i=0; i<nblocks; i++) {
+		SWIFFT_updateBits(output + (size_t)i*SWIFFT_OUTPUT_BLOCK_SIZE, npositions, positions,
+			oldInput + (size_t)i*SWIFFT_INPUT_BLOCK_SIZE, oldSign + (size_t)i*signStride,
+			newInput + (size_t)i*SWIFFT_INPUT_BLOCK_SIZE, newSign + (size_t)i*signStride);
+	}
+}
+
+//! \brief Updates the result of a SWIFFT operation for a change of some input bits.
+//! The result is the same as computing SWIFFT_Compute of the new input, in time proportional to the number of positions.
+//!
+//! \param[in,out] output the hash value of SWIFFT of the old input, of size 128 bytes (1024 bit), to update to that of the new input.
+//! \param[in] npositions the number of positions of input bits to update.
+//! \param[in] positions the distinct positions of the input bits that may have changed, each in {0,..,2047} for bit p&7 of byte p>>3.
+//! \param[in] oldInput the old input of 256 bytes (2048 bit).
+//! \param[in] newInput the new input of 256 bytes (2048 bit).
+void SWIFFT_ISET_NAME(SWIFFT_UpdateBits_)(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
+	int npositions, const int * positions, const BitSequence * oldInput, const BitSequence * newInput)
+{
+	SWIFFT_updateBits(output, npositions, positions, oldInput, SWIFFT_sign0, newInput, SWIFFT_sign0);
+}
+
+//! \brief Updates the result of a SWIFFT operation for a change of some input bits or their sign bits.
+//! The result is the same as computing SWIFFT_ComputeSigned of the new input, in time proportional to the number of positions.
+//!
+//! \param[in,out] output the hash value of SWIFFT of the old input, of size 128 bytes (1024 bit), to update to that of the new input.
+//! \param[in] npositions the number of positions of input bits to update.
+//! \param[in] positions the distinct positions of the input bits that may have changed, each in {0,..,2047} for bit p&7 of byte p>>3.
+//! \param[in] oldInput the old input of 256 bytes (2048 bit).
+//! \param[in] oldSign the sign bits corresponding to the old input of 256 bytes (2048 bit).
+//! \param[in] newInput the new input of 256 bytes (2048 bit).
+//! \param[in] newSign the sign bits corresponding to the new input of 256 bytes (2048 bit).
+void SWIFFT_ISET_NAME(SWIFFT_UpdateBitsSigned_)(BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE],
+	int npositions, const int * positions, const BitSequence * oldInput, const BitSequence * oldSign,
+	const BitSequence * newInput, const BitSequence * newSign)
+{
+	SWIFFT_updateBits(output, npositions, positions, oldInput, oldSign, newInput, newSign);
+}
+
+//! \brief Updates the results of multiple SWIFFT operations for a change of some input bits.
+//! The result is the same as computing SWIFFT_ComputeMultiple of the new inputs, in time proportional to the number of positions.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the blocks of hash values of SWIFFT of the old inputs, each of size 128 bytes (1024 bit), to update to those of the new inputs.
+//! \param[in] npositions the number of positions of input bits to update in each block.
+//! \param[in] positions the distinct positions of the input bits that may have changed in each block, each in {0,..,2047} for bit p&7 of byte p>>3.
+//! \param[in] oldInput the blocks of old input, each of 256 bytes (2048 bit).
+//! \param[in] newInput the blocks of new input, each of 256 bytes (2048 bit).
+void SWIFFT_ISET_NAME(SWIFFT_UpdateBitsMultiple_)(int nblocks, BitSequence * output,
+	int npositions, const int * positions, const BitSequence * oldInput, const BitSequence * newInput)
+{
+	SWIFFT_updateBitsMultiple(nblocks, output, npositions, positions, oldInput, SWIFFT_sign0, newInput, SWIFFT_sign0, 0);
+}
+
+//! \brief Updates the results of multiple SWIFFT operations for a change of some input bits or their sign bits.
+//! The result is the same as computing SWIFFT_ComputeMultipleSigned of the new inputs, in time proportional to the number of positions.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in,out] output the blocks of hash values of SWIFFT of the old inputs, each of size 128 bytes (1024 bit), to update to those of the new inputs.
+//! \param[in] npositions the number of positions of input bits to update in each block.
+//! \param[in] positions the distinct positions of the input bits that may have changed in each block, each in {0,..,2047} for bit p&7 of byte p>>3.
+//! \param[in] oldInput the blocks of old input, each of 256 bytes (2048 bit).
+//! \param[in] oldSign the blocks of sign bits corresponding to blocks of old input of 256 bytes (2048 bit).
+//! \param[in] newInput the blocks of new input, each of 256 bytes (2048 bit).
+//! \param[in] newSign the blocks of sign bits corresponding to blocks of new input of 256 bytes (2048 bit).
+void SWIFFT_ISET_NAME(SWIFFT_UpdateBitsMultipleSigned_)(int nblocks, BitSequence * output,
+	int npositions, const int * positions, const BitSequence * oldInput, const BitSequence * oldSign,
+	const BitSequence * newInput, const BitSequence * newSign)
+{
+	SWIFFT_updateBitsMultiple(nblocks, output, npositions, positions, oldInput, oldSign, newInput, newSign, SWIFFT_INPUT_BLOCK_SIZE);
+}
+
+#ifndef SWIFFT_SPARSE_DENSE_THRESHOLD
+	//! Number of nonzero input bits above which hashing a sparse input is faster via the FFT than by summing their contributions,
+	//! as measured at about 370, 450 and 560 for SWIFFT_O of 1, 2 and 4, respectively
+	#define SWIFFT_SPARSE_DENSE_THRESHOLD (320 + 64*SWIFFT_O)
+#endif
+
+//! \brief Computes the result of a SWIFFT operation on a sparse input.
+//! For few nonzero input bits, their contributions from SWIFFT_bitTable are summed, in time proportional
+//! to their number, and otherwise the input is expanded and its hash value is computed as usual.
+//!
+//! \param[in] count the number of nonzero input bits.
+//! \param[in] indices the distinct positions of the nonzero input bits, each in {0,..,2047} for bit p&7 of byte p>>3.
+//! \param[in] sign the signs of the nonzero input bits, each 1 for negative or 0 for positive, or NULL for all positive.
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+static inline void SWIFFT_computeSparse(int count, const int * indices, const BitSequence * sign, BitSequence * output)
+{
+	int i,j,n=0;
+	ZOvec *out = (ZOvec *)output;
+	ZOvec acc[8 >> SWIFFT_LOG2_O];
+	// masks for negating, by xor-ing and subtracting, indexed by the sign
+	const ZOvec masks[2] = {ZOCONST(0), ZOCONST(-1)};
+
+	if (count > SWIFFT_SPARSE_DENSE_THRESHOLD) {
+		// setting the bits in 64-bit words, in which bit p&63 of word p>>6 is bit p&7 of byte p>>3
+		SWIFFT_ALIGN uint64_t input[SWIFFT_INPUT_BLOCK_SIZE/8] = {0};
+		SWIFFT_ALIGN uint64_t isign[SWIFFT_INPUT_BLOCK_SIZE/8] = {0};
+		for (i=0; i<count; i++) {
+			int p = indices[i];
+			input[p >> 6] |= (uint64_t)1 << (p & 63);
+			isign[p >> 6] |= (uint64_t)(sign && sign[i]) << (p & 63);
+		}
+		SWIFFT_compute((const BitSequence *)input, sign ? (const BitSequence *)isign : SWIFFT_sign0, SWIFFT_KEY_O, output);
+		return;
+	}
+	for (j=0; j<(8>>SWIFFT_LOG2_O); j++) {
+		acc[j] = (ZOvec)ZOCONST(0);
+	}
+	for (i=0; i<count; i++) {
+		const ZOvec *contrib = (const ZOvec *)(SWIFFT_bitTable + (size_t)indices[i]*SWIFFT_N);
+		ZOvec mask = masks[sign && sign[i]];
+		for (j=0; j<(8>>SWIFFT_LOG2_O); j++) {
+			acc[j] += (contrib[j] ^ mask) - mask;
+		}
+		if (++n == SWIFFT_UPDATE_BITS_REDUCE_INTERVAL) {
+			for (j=0; j<(8>>SWIFFT_LOG2_O); j++) {
+				acc[j] = SWIFFT_qReduce(acc[j]);
+			}
+			n = 0;
+		}
+	}
+	for (j=0; j<(8>>SWIFFT_LOG2_O); j++) {
+		out[j] = SWIFFT_modP(acc[j]);
+	}
+}
+
+//! \brief Computes the results of multiple SWIFFT operations on sparse inputs.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] offsets the offsets of the nonzero input bits of each block in indices, followed by their total number.
+//! \param[in] indices the distinct positions of the nonzero input bits of each block.
+//! \param[in] sign the signs of the nonzero input bits, each 1 for negative or 0 for positive, or NULL for all positive.
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+static inline void SWIFFT_computeSparseMultiple(int nblocks, const int * offsets, const int * indices,
+	const BitSequence * sign, BitSequence * output)
+{
+	int i;
+#ifdef _OPENMP
+	#pragma omp parallel for schedule(static) private(i) if(nblocks > SWIFFT_BLOCKS_PARALLELIZATION_THRESHOLD)
+#endif
+	for (i=0; i<nblocks; i++) {
+		SWIFFT_computeSparse(offsets[i+1] - offsets[i], indices + offsets[i], sign ? sign + offsets[i] : NULL,
+			output + (size_t)i*SWIFFT_OUTPUT_BLOCK_SIZE);
+	}
+}
+
+//! \brief Computes the result of a SWIFFT operation on a sparse input, given by the positions of its nonzero bits.
+//! The result is the same as for SWIFFT_Compute, in time proportional to the number of nonzero bits when they are few.
+//!
+//! \param[in] count the number of nonzero input bits.
+//! \param[in] indices the distinct positions of the nonzero input bits, each in {0,..,2047} for bit p&7 of byte p>>3.
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeSparse_)(int count, const int * indices, BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_computeSparse(count, indices, NULL, output);
+}
+
+//! \brief Computes the result of a SWIFFT operation on a sparse input, given by the positions and signs of its nonzero bits.
+//! The result is the same as for SWIFFT_ComputeSigned, in time proportional to the number of nonzero bits when they are few.
+//!
+//! \param[in] count the number of nonzero input bits.
+//! \param[in] indices the distinct positions of the nonzero input bits, each in {0,..,2047} for bit p&7 of byte p>>3.
+//! \param[in] sign the signs of the nonzero input bits, each 1 for negative or 0 for positive.
+//! \param[out] output the resulting hash value of SWIFFT, of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeSparseSigned_)(int count, const int * indices, const BitSequence * sign,
+	BitSequence output[SWIFFT_OUTPUT_BLOCK_SIZE])
+{
+	SWIFFT_computeSparse(count, indices, sign, output);
+}
+
+//! \brief Computes the results of multiple SWIFFT operations on sparse inputs, given by the positions of their nonzero bits.
+//! The result is the same as for SWIFFT_ComputeMultiple, in time proportional to the number of nonzero bits when they are few.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] offsets the nblocks+1 offsets in indices where the nonzero input bits of each block start, followed by their total number.
+//! \param[in] indices the distinct positions of the nonzero input bits of each block, each in {0,..,2047} for bit p&7 of byte p>>3.
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeSparseMultiple_)(int nblocks, const int * offsets, const int * indices,
+	BitSequence * output)
+{
+	SWIFFT_computeSparseMultiple(nblocks, offsets, indices, NULL, output);
+}
+
+//! \brief Computes the results of multiple SWIFFT operations on sparse inputs, given by the positions and signs of their nonzero bits.
+//! The result is the same as for SWIFFT_ComputeMultipleSigned, in time proportional to the number of nonzero bits when they are few.
+//!
+//! \param[in] nblocks the number of blocks to operate on.
+//! \param[in] offsets the nblocks+1 offsets in indices where the nonzero input bits of each block start, followed by their total number.
+//! \param[in] indices the distinct positions of the nonzero input bits of each block, each in {0,..,2047} for bit p&7 of byte p>>3.
+//! \param[in] sign the signs of the nonzero input bits, each 1 for negative or 0 for positive.
+//! \param[out] output the resulting blocks of hash values of SWIFFT, each of size 128 bytes (1024 bit).
+void SWIFFT_ISET_NAME(SWIFFT_ComputeSparseMultipleSigned_)(int nblocks, const int * offsets, const int * indices,
+	const BitSequence * sign, BitSequence * output)
+{
+	SWIFFT_computeSparseMultiple(nblocks, offsets, indices, sign, output);
+}
+
 LIBSWIFFT_END_EXTERN_C
@@ -12,7 +12,9 @@
 
 #if defined(__AVX512F__)
 	#include "libswifft/swifft_avx512.h"
-	#define SWIFFT_LOG2_O 2
+	// AVX512F has no 16-bit arithmetic on 512-bit vectors, which would be emulated slowly,
+	// so 256-bit vectors are used (see "src/swifft_avx512bw.c" for 512-bit vectors)
+	#define SWIFFT_LOG2_O 1
 	#include "swifft.inl"
 #else
 	#pragma message "Disabling generation of LibSWIFFT API for AVX512"
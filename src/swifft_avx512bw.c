@@ -0,0 +1,19 @@
+/*
+ * Copyright (C) 2021 Yaron Gvili and Gvili Tech Ltd.
+ *
+ * See the accompanying LICENSE.txt file for licensing information.
+ */
+/*! \file src/swifft_avx512bw.c
+ * \brief LibSWIFFT public C implementation for AVX512BW
+ *
+ * See "src/swifft.inl" for code expanded here with SWIFFT_ISET set to AVX512BW.
+ */
+#include "libswifft/common.h"
+
+#if defined(__AVX512BW__)
+	#include "libswifft/swifft_avx512bw.h"
+	#define SWIFFT_LOG2_O 2
+	#include "swifft.inl"
+#else
+	#pragma message "Disabling generation of LibSWIFFT API for AVX512BW"
+#endif
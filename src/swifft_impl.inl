@@ -19,9 +19,13 @@
         #define SWIFFT_INSTRUCTION_SET AVX
         #define SWIFFT_VECTOR_LOG2_SIZE 3
 #else
-        #error "AVX, AVX2, or AVX512F must be enabled"
+        // no instruction-set extension: only code that does not depend on one may be compiled,
+        // such as the runtime selection of the instruction-set
+        #define SWIFFT_VECTOR_LOG2_SIZE 3
 #endif
 #define SWIFFT_VECTOR_SIZE (1 << SWIFFT_VECTOR_LOG2_SIZE)
+#define SWIFFT_MAX_LOG2_O (MAX_SWIFFT_VECTOR_LOG2_SIZE - 3) ///< Log base-2 of SWIFFT_MAX_O
+#define SWIFFT_MAX_O (1 << SWIFFT_MAX_LOG2_O)               ///< Maximum number of doublings of the wide SWIFFT vector
 
 
 #define SWIFFT_LOG2_N 6                        ///< Log base-2 of SWIFFT_N
@@ -43,7 +47,14 @@ LIBSWIFFT_BEGIN_EXTERN_C
 extern const BitSequence SWIFFT_sign0[SWIFFT_INPUT_BLOCK_SIZE];
 
 extern const int16_t SWIFFT_multipliers[SWIFFT_N];
+extern const int16_t SWIFFT_multipliersO[SWIFFT_N*SWIFFT_MAX_O];
 extern const int16_t SWIFFT_fftTable[SWIFFT_V*SWIFFT_V*SWIFFT_W];
 extern const int16_t SWIFFT_PI_key[SWIFFT_M*SWIFFT_N];
+extern const int16_t SWIFFT_PI_keyO[(SWIFFT_MAX_LOG2_O+1)*SWIFFT_M*SWIFFT_N];
+extern const int16_t SWIFFT_nttTwistO[SWIFFT_N*SWIFFT_MAX_O];
+extern const int16_t SWIFFT_nttTwiddleO[SWIFFT_N*SWIFFT_MAX_O];
+extern const int16_t SWIFFT_inttTwiddleO[SWIFFT_N*SWIFFT_MAX_O];
+extern const int16_t SWIFFT_inttTwistO[SWIFFT_N*SWIFFT_MAX_O];
+extern const int16_t SWIFFT_bitTable[SWIFFT_INPUT_BLOCK_SIZE*8*SWIFFT_N];
 
 LIBSWIFFT_END_EXTERN_C
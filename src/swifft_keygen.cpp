@@ -18,6 +18,8 @@
 
 //! \brief Multipliers for SWIFFT key.
 static SWIFFT_ALIGN int16_t multipliers[SWIFFT_N];
+//! \brief Multipliers for SWIFFT key, with each 8 of them repeated SWIFFT_MAX_O times.
+static SWIFFT_ALIGN int16_t multipliersO[SWIFFT_N*SWIFFT_MAX_O];
 //! \brief FFT table for SWIFFT key.
 static SWIFFT_ALIGN int16_t fftTable[SWIFFT_V*SWIFFT_V*SWIFFT_W];
 
@@ -157,6 +159,21 @@ static SWIFFT_ALIGN int16_t PI_key[SWIFFT_M*SWIFFT_N] = {
 	 41,  53, 241,  22, 115, 174,  16, 163, 224,  19, 112, 219, 177, 233,  42,  27,
 	250, 134,  18,  28, 145, 122,  68,  34, 134,  31, 147,  17,  39, 188, 150,  76,
 };
+//! \brief SWIFFT key in layouts for fused FFT and FFT-sum, one per log base-2 of SWIFFT_O.
+//! In the layout for SWIFFT_O, the j-th part of the k-th wide SWIFFT vector of the i-th group
+//! of 8 wide SWIFFT vectors is the k-th SWIFFT vector of the key for 8-element i*SWIFFT_O+j.
+static SWIFFT_ALIGN int16_t PI_keyO[(SWIFFT_MAX_LOG2_O+1)*SWIFFT_M*SWIFFT_N];
+//! \brief Twist of the coefficients by powers of OMEGA for the transform to evaluations, in the layout of multipliersO.
+static SWIFFT_ALIGN int16_t nttTwistO[SWIFFT_N*SWIFFT_MAX_O];
+//! \brief Twiddle factors, powers of OMEGA^2, for the transform to evaluations, in the layout of multipliersO.
+static SWIFFT_ALIGN int16_t nttTwiddleO[SWIFFT_N*SWIFFT_MAX_O];
+//! \brief Twiddle factors for the transform to coefficients, inverse to those of nttTwiddleO.
+static SWIFFT_ALIGN int16_t inttTwiddleO[SWIFFT_N*SWIFFT_MAX_O];
+//! \brief Twist of the coefficients for the transform to coefficients, inverse to that of nttTwistO and divided by SWIFFT_N.
+static SWIFFT_ALIGN int16_t inttTwistO[SWIFFT_N*SWIFFT_MAX_O];
+//! \brief Contributions of input bits to the SWIFFT hash value.
+//! The p-th group of SWIFFT_N elements is the hash value, centered, of the input with only bit p&7 of byte p>>3 set.
+static SWIFFT_ALIGN int16_t bitTable[SWIFFT_INPUT_BLOCK_SIZE*8*SWIFFT_N];
 
 
 //! \brief Centers a mod-257 number around 0.
@@ -189,6 +206,53 @@ static int ReverseBits(int input, int numOfBits)
 	return reversed;
 }
 
+//! \brief Computes the FFT of an 8-element of input, the same as SWIFFT_fftO does without reducing.
+//! \param[in] input the 8 bytes of input of the 8-element.
+//! \param[out] fftout the FFT-output elements, centered.
+static void ComputeFFT(const uint8_t input[8], int fftout[SWIFFT_N])
+{
+	int j, k;
+	int v[8][SWIFFT_W];
+
+	for (k = 0; k < 8; ++k)
+	{
+		for (j = 0; j < SWIFFT_W; ++j)
+		{
+			v[k][j] = fftTable[(input[k] << SWIFFT_LOG2_W) + j] * (k == 0 ? 1 : multipliers[(k << SWIFFT_LOG2_W) + j]);
+		}
+	}
+	for (j = 0; j < SWIFFT_W; ++j)
+	{
+		// shifting left by s is multiplying by 2^s mod 257
+		SWIFFT_AddSub(v[0][j], v[1][j]);
+		SWIFFT_AddSub(v[2][j], v[3][j]);
+		SWIFFT_AddSub(v[4][j], v[5][j]);
+		SWIFFT_AddSub(v[6][j], v[7][j]);
+		v[3][j] = Center(v[3][j] << 4);
+		v[7][j] = Center(v[7][j] << 4);
+
+		SWIFFT_AddSub(v[0][j], v[2][j]);
+		SWIFFT_AddSub(v[1][j], v[3][j]);
+		SWIFFT_AddSub(v[4][j], v[6][j]);
+		SWIFFT_AddSub(v[5][j], v[7][j]);
+		v[5][j] = Center(v[5][j] << 2);
+		v[6][j] = Center(v[6][j] << 4);
+		v[7][j] = Center(v[7][j] << 6);
+
+		SWIFFT_AddSub(v[0][j], v[4][j]);
+		SWIFFT_AddSub(v[1][j], v[5][j]);
+		SWIFFT_AddSub(v[2][j], v[6][j]);
+		SWIFFT_AddSub(v[3][j], v[7][j]);
+	}
+	for (k = 0; k < 8; ++k)
+	{
+		for (j = 0; j < SWIFFT_W; ++j)
+		{
+			fftout[(k << SWIFFT_LOG2_W) + j] = Center(v[k][j]);
+		}
+	}
+}
+
 //! \brief Initializes the key along with the related multipliers and FFT table.
 static void SWIFFT_Initialize()
 {
@@ -212,6 +276,10 @@ static void SWIFFT_Initialize()
 		for (j = 0; j < SWIFFT_W; ++j)
 		{
 			multipliers[(i << SWIFFT_LOG2_W) + j] = omegaPowers[reverseBits[i] * (2 * j + 1)];
+			for (k = 0; k < SWIFFT_MAX_O; ++k)
+			{
+				multipliersO[(((i << SWIFFT_MAX_LOG2_O) + k) << SWIFFT_LOG2_W) + j] = multipliers[(i << SWIFFT_LOG2_W) + j];
+			}
 		}
 	}
 
@@ -240,6 +308,57 @@ static void SWIFFT_Initialize()
 	for (j=0; j<SWIFFT_N*SWIFFT_M; j++) {
 		PI_key[j] = Center(PI_key[j]);
 	}
+
+	for (int log2O = 0; log2O <= SWIFFT_MAX_LOG2_O; ++log2O)
+	{
+		int O = 1 << log2O;
+		int16_t *keyO = PI_keyO + log2O*SWIFFT_M*SWIFFT_N;
+		for (i = 0; i < SWIFFT_M; ++i)
+		{
+			for (k = 0; k < 8; ++k)
+			{
+				for (j = 0; j < SWIFFT_W; ++j)
+				{
+					keyO[((((i >> log2O) * 8 + k) * O + (i & (O - 1))) << SWIFFT_LOG2_W) + j] = PI_key[(((i * 8) + k) << SWIFFT_LOG2_W) + j];
+				}
+			}
+		}
+	}
+
+	// the i-th output element is the evaluation at OMEGA^(2i+1) of a polynomial mod x^64+1, so
+	// the coefficient c is twisted by OMEGA^c before a transform with OMEGA^2 and the inverse after
+	int inverseN = 1;
+	while (Center(inverseN * SWIFFT_N) != 1)
+		++inverseN;
+	for (i = 0; i < (SWIFFT_N / SWIFFT_W); ++i)
+	{
+		for (j = 0; j < SWIFFT_W; ++j)
+		{
+			int c = (i << SWIFFT_LOG2_W) + j;
+			for (k = 0; k < SWIFFT_MAX_O; ++k)
+			{
+				int idx = (((i << SWIFFT_MAX_LOG2_O) + k) << SWIFFT_LOG2_W) + j;
+				nttTwistO[idx] = omegaPowers[c];
+				nttTwiddleO[idx] = omegaPowers[(2 * i * j) % (2 * SWIFFT_N)];
+				inttTwiddleO[idx] = omegaPowers[(2 * SWIFFT_N - (2 * i * j) % (2 * SWIFFT_N)) % (2 * SWIFFT_N)];
+				inttTwistO[idx] = Center(inverseN * omegaPowers[2 * SWIFFT_N - c]);
+			}
+		}
+	}
+
+	// the hash value is linear in the input bits, each of which contributes only via the FFT of its 8-element
+	for (int p = 0; p < SWIFFT_INPUT_BLOCK_SIZE*8; ++p)
+	{
+		uint8_t input[8] = {0};
+		int fftout[SWIFFT_N];
+		i = p >> 6;
+		input[(p >> 3) & 7] = 1 << (p & 7);
+		ComputeFFT(input, fftout);
+		for (j = 0; j < SWIFFT_N; ++j)
+		{
+			bitTable[p*SWIFFT_N + j] = Center(PI_key[i*SWIFFT_N + j] * fftout[j]);
+		}
+	}
 }
 
 
@@ -281,8 +400,22 @@ int main(int argc, char **argv)
 	out << std::endl;
 	writeArray(out, multipliers, SWIFFT_N, "multipliers[SWIFFT_N]");
 	out << std::endl;
+	writeArray(out, multipliersO, SWIFFT_N*SWIFFT_MAX_O, "multipliersO[SWIFFT_N*SWIFFT_MAX_O]");
+	out << std::endl;
 	writeArray(out, fftTable, SWIFFT_V*SWIFFT_V*SWIFFT_W, "fftTable[SWIFFT_V*SWIFFT_V*SWIFFT_W]");
 	out << std::endl;
 	writeArray(out, PI_key, SWIFFT_M*SWIFFT_N, "PI_key[SWIFFT_M*SWIFFT_N]");
+	out << std::endl;
+	writeArray(out, PI_keyO, (SWIFFT_MAX_LOG2_O+1)*SWIFFT_M*SWIFFT_N, "PI_keyO[(SWIFFT_MAX_LOG2_O+1)*SWIFFT_M*SWIFFT_N]");
+	out << std::endl;
+	writeArray(out, nttTwistO, SWIFFT_N*SWIFFT_MAX_O, "nttTwistO[SWIFFT_N*SWIFFT_MAX_O]");
+	out << std::endl;
+	writeArray(out, nttTwiddleO, SWIFFT_N*SWIFFT_MAX_O, "nttTwiddleO[SWIFFT_N*SWIFFT_MAX_O]");
+	out << std::endl;
+	writeArray(out, inttTwiddleO, SWIFFT_N*SWIFFT_MAX_O, "inttTwiddleO[SWIFFT_N*SWIFFT_MAX_O]");
+	out << std::endl;
+	writeArray(out, inttTwistO, SWIFFT_N*SWIFFT_MAX_O, "inttTwistO[SWIFFT_N*SWIFFT_MAX_O]");
+	out << std::endl;
+	writeArray(out, bitTable, SWIFFT_INPUT_BLOCK_SIZE*8*SWIFFT_N, "bitTable[SWIFFT_INPUT_BLOCK_SIZE*8*SWIFFT_N]");
 	return 0;
 }
@@ -6,38 +6,62 @@
 /*! \file src/swifft_object.c
  * \brief LibSWIFFT object public C implementation
  *
- * Implementation using the best instruction set available at build time.
+ * Implementation for each instruction set, and for the one selected at runtime.
  */
 
+#include <string.h> // for memset
 #include "libswifft/swifft_object.h"
 #include "libswifft/swifft.h"
 
 #undef SWIFFT_ISET
+#define SWIFFT_ISET() AVX
 #include "swifft_object.inl"
+#undef SWIFFT_ISET
+
+#define SWIFFT_ISET() AVX2
+#include "swifft_object.inl"
+#undef SWIFFT_ISET
+
+#define SWIFFT_ISET() AVX512
+#include "swifft_object.inl"
+#undef SWIFFT_ISET
+
+#define SWIFFT_ISET() AVX512BW
+#include "swifft_object.inl"
+#undef SWIFFT_ISET
+
+LIBSWIFFT_BEGIN_EXTERN_C
+
+int SWIFFT_InitIsetObject(swifft_object_t *swifft, swifft_iset_t iset)
+{
+	if (!SWIFFT_IsIsetSupported(iset)) {
+		return -1;
+	}
+	switch (iset) {
+	case SWIFFT_ISET_AVX:
+		SWIFFT_InitObject_AVX(swifft);
+		break;
+	case SWIFFT_ISET_AVX2:
+		SWIFFT_InitObject_AVX2(swifft);
+		break;
+	case SWIFFT_ISET_AVX512:
+		SWIFFT_InitObject_AVX512(swifft);
+		break;
+	case SWIFFT_ISET_AVX512BW:
+		SWIFFT_InitObject_AVX512BW(swifft);
+		break;
+	default:
+		return -1;
+	}
+	return 0;
+}
+
+void SWIFFT_InitObject(swifft_object_t *swifft)
+{
+	if (SWIFFT_InitIsetObject(swifft, SWIFFT_GetIset()) != 0) {
+		// no supported instruction-set: the object has no functions, like the main API
+		memset(swifft, 0, sizeof(*swifft));
+	}
+}
 
-#if defined(__AVX__)
-	#include "libswifft/swifft_avx.h"
-        #define SWIFFT_ISET() AVX
-        #include "swifft_object.inl"
-        #undef SWIFFT_ISET
-#else
-        #pragma message "LibSWIFFT API for AVX is disabled"
-#endif
-
-#if defined(__AVX2__)
-	#include "libswifft/swifft_avx2.h"
-        #define SWIFFT_ISET() AVX2
-        #include "swifft_object.inl"
-        #undef SWIFFT_ISET
-#else
-        #pragma message "LibSWIFFT API for AVX2 is disabled"
-#endif
-
-#if defined(__AVX512F__)
-	#include "libswifft/swifft_avx512.h"
-        #define SWIFFT_ISET() AVX512
-        #include "swifft_object.inl"
-        #undef SWIFFT_ISET
-#else
-        #pragma message "LibSWIFFT API for AVX512 is disabled"
-#endif
+LIBSWIFFT_END_EXTERN_C
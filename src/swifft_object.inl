@@ -41,6 +41,10 @@ void SWIFFT_ISET_NAME(SWIFFT_InitArithObject)(swifft_arith_object_t *swifft_arit
 	swifft_arith->SWIFFT_Add = SWIFFT_ISET_NAME(SWIFFT_Add);
 	swifft_arith->SWIFFT_Sub = SWIFFT_ISET_NAME(SWIFFT_Sub);
 	swifft_arith->SWIFFT_Mul = SWIFFT_ISET_NAME(SWIFFT_Mul);
+	swifft_arith->SWIFFT_MulAdd = SWIFFT_ISET_NAME(SWIFFT_MulAdd);
+	swifft_arith->SWIFFT_MulSub = SWIFFT_ISET_NAME(SWIFFT_MulSub);
+	swifft_arith->SWIFFT_ConstMulAdd = SWIFFT_ISET_NAME(SWIFFT_ConstMulAdd);
+	swifft_arith->SWIFFT_ConstMulSub = SWIFFT_ISET_NAME(SWIFFT_ConstMulSub);
 	swifft_arith->SWIFFT_ConstSetMultiple = SWIFFT_ISET_NAME(SWIFFT_ConstSetMultiple);
 	swifft_arith->SWIFFT_ConstAddMultiple = SWIFFT_ISET_NAME(SWIFFT_ConstAddMultiple);
 	swifft_arith->SWIFFT_ConstSubMultiple = SWIFFT_ISET_NAME(SWIFFT_ConstSubMultiple);
@@ -49,16 +53,92 @@ void SWIFFT_ISET_NAME(SWIFFT_InitArithObject)(swifft_arith_object_t *swifft_arit
 	swifft_arith->SWIFFT_AddMultiple = SWIFFT_ISET_NAME(SWIFFT_AddMultiple);
 	swifft_arith->SWIFFT_SubMultiple = SWIFFT_ISET_NAME(SWIFFT_SubMultiple);
 	swifft_arith->SWIFFT_MulMultiple = SWIFFT_ISET_NAME(SWIFFT_MulMultiple);
+	swifft_arith->SWIFFT_MulAddMultiple = SWIFFT_ISET_NAME(SWIFFT_MulAddMultiple);
+	swifft_arith->SWIFFT_MulSubMultiple = SWIFFT_ISET_NAME(SWIFFT_MulSubMultiple);
+	swifft_arith->SWIFFT_ConstMulAddMultiple = SWIFFT_ISET_NAME(SWIFFT_ConstMulAddMultiple);
+	swifft_arith->SWIFFT_ConstMulSubMultiple = SWIFFT_ISET_NAME(SWIFFT_ConstMulSubMultiple);
+	swifft_arith->SWIFFT_SetBroadcast = SWIFFT_ISET_NAME(SWIFFT_SetBroadcast);
+	swifft_arith->SWIFFT_AddBroadcast = SWIFFT_ISET_NAME(SWIFFT_AddBroadcast);
+	swifft_arith->SWIFFT_SubBroadcast = SWIFFT_ISET_NAME(SWIFFT_SubBroadcast);
+	swifft_arith->SWIFFT_MulBroadcast = SWIFFT_ISET_NAME(SWIFFT_MulBroadcast);
+	swifft_arith->SWIFFT_ConstMulOuter = SWIFFT_ISET_NAME(SWIFFT_ConstMulOuter);
+	swifft_arith->SWIFFT_LinearCombination = SWIFFT_ISET_NAME(SWIFFT_LinearCombination);
+	swifft_arith->SWIFFT_LinearCombinationMultiple = SWIFFT_ISET_NAME(SWIFFT_LinearCombinationMultiple);
+	swifft_arith->SWIFFT_MatMulOutputs = SWIFFT_ISET_NAME(SWIFFT_MatMulOutputs);
+	swifft_arith->SWIFFT_ToCoefficients = SWIFFT_ISET_NAME(SWIFFT_ToCoefficients);
+	swifft_arith->SWIFFT_FromCoefficients = SWIFFT_ISET_NAME(SWIFFT_FromCoefficients);
+	swifft_arith->SWIFFT_ToCoefficientsMultiple = SWIFFT_ISET_NAME(SWIFFT_ToCoefficientsMultiple);
+	swifft_arith->SWIFFT_FromCoefficientsMultiple = SWIFFT_ISET_NAME(SWIFFT_FromCoefficientsMultiple);
+	swifft_arith->SWIFFT_Canonicalize = SWIFFT_ISET_NAME(SWIFFT_Canonicalize);
+	swifft_arith->SWIFFT_CanonicalizeMultiple = SWIFFT_ISET_NAME(SWIFFT_CanonicalizeMultiple);
+	swifft_arith->SWIFFT_Equal = SWIFFT_ISET_NAME(SWIFFT_Equal);
+	swifft_arith->SWIFFT_EqualMultiple = SWIFFT_ISET_NAME(SWIFFT_EqualMultiple);
+	swifft_arith->SWIFFT_FindMatch = SWIFFT_ISET_NAME(SWIFFT_FindMatch);
+	swifft_arith->SWIFFT_SumMultiple = SWIFFT_ISET_NAME(SWIFFT_SumMultiple);
+	swifft_arith->SWIFFT_ProductMultiple = SWIFFT_ISET_NAME(SWIFFT_ProductMultiple);
+	swifft_arith->SWIFFT_AccumulatorInit = SWIFFT_ISET_NAME(SWIFFT_AccumulatorInit);
+	swifft_arith->SWIFFT_AccumulatorAdd = SWIFFT_ISET_NAME(SWIFFT_AccumulatorAdd);
+	swifft_arith->SWIFFT_AccumulatorSub = SWIFFT_ISET_NAME(SWIFFT_AccumulatorSub);
+	swifft_arith->SWIFFT_AccumulatorAddMultiple = SWIFFT_ISET_NAME(SWIFFT_AccumulatorAddMultiple);
+	swifft_arith->SWIFFT_AccumulatorSubMultiple = SWIFFT_ISET_NAME(SWIFFT_AccumulatorSubMultiple);
+	swifft_arith->SWIFFT_AccumulatorGet = SWIFFT_ISET_NAME(SWIFFT_AccumulatorGet);
 }
 
 void SWIFFT_ISET_NAME(SWIFFT_InitHashObject)(swifft_hash_object_t *swifft_hash)
 {
-	swifft_hash->SWIFFT_Compact = SWIFFT_Compact;
+	swifft_hash->SWIFFT_Compact = SWIFFT_ISET_NAME(SWIFFT_Compact);
 	swifft_hash->SWIFFT_Compute = SWIFFT_ISET_NAME(SWIFFT_Compute);
 	swifft_hash->SWIFFT_ComputeSigned = SWIFFT_ISET_NAME(SWIFFT_ComputeSigned);
 	swifft_hash->SWIFFT_CompactMultiple = SWIFFT_ISET_NAME(SWIFFT_CompactMultiple);
+	swifft_hash->SWIFFT_CompactWithCarry = SWIFFT_ISET_NAME(SWIFFT_CompactWithCarry);
+	swifft_hash->SWIFFT_CompactWithCarryMultiple = SWIFFT_ISET_NAME(SWIFFT_CompactWithCarryMultiple);
+	swifft_hash->SWIFFT_Decompact = SWIFFT_ISET_NAME(SWIFFT_Decompact);
+	swifft_hash->SWIFFT_DecompactMultiple = SWIFFT_ISET_NAME(SWIFFT_DecompactMultiple);
+	swifft_hash->SWIFFT_CompactEqualMultiple = SWIFFT_ISET_NAME(SWIFFT_CompactEqualMultiple);
+	swifft_hash->SWIFFT_FindCompactMatch = SWIFFT_ISET_NAME(SWIFFT_FindCompactMatch);
 	swifft_hash->SWIFFT_ComputeMultiple = SWIFFT_ISET_NAME(SWIFFT_ComputeMultiple);
 	swifft_hash->SWIFFT_ComputeMultipleSigned = SWIFFT_ISET_NAME(SWIFFT_ComputeMultipleSigned);
+	swifft_hash->SWIFFT_ComputeKeyed = SWIFFT_ISET_NAME(SWIFFT_ComputeKeyed);
+	swifft_hash->SWIFFT_ComputeSignedKeyed = SWIFFT_ISET_NAME(SWIFFT_ComputeSignedKeyed);
+	swifft_hash->SWIFFT_ComputeMultipleKeyed = SWIFFT_ISET_NAME(SWIFFT_ComputeMultipleKeyed);
+	swifft_hash->SWIFFT_ComputeMultipleSignedKeyed = SWIFFT_ISET_NAME(SWIFFT_ComputeMultipleSignedKeyed);
+	swifft_hash->SWIFFT_ComputeMultiKey = SWIFFT_ISET_NAME(SWIFFT_ComputeMultiKey);
+	swifft_hash->SWIFFT_ComputeSignedMultiKey = SWIFFT_ISET_NAME(SWIFFT_ComputeSignedMultiKey);
+	swifft_hash->SWIFFT_ComputeMultipleMultiKey = SWIFFT_ISET_NAME(SWIFFT_ComputeMultipleMultiKey);
+	swifft_hash->SWIFFT_ComputeMultipleSignedMultiKey = SWIFFT_ISET_NAME(SWIFFT_ComputeMultipleSignedMultiKey);
+	swifft_hash->SWIFFT_DeriveKey = SWIFFT_ISET_NAME(SWIFFT_DeriveKey);
+	swifft_hash->SWIFFT_Compute128 = SWIFFT_ISET_NAME(SWIFFT_Compute128);
+	swifft_hash->SWIFFT_ComputeSigned128 = SWIFFT_ISET_NAME(SWIFFT_ComputeSigned128);
+	swifft_hash->SWIFFT_ComputeMultiple128 = SWIFFT_ISET_NAME(SWIFFT_ComputeMultiple128);
+	swifft_hash->SWIFFT_ComputeMultipleSigned128 = SWIFFT_ISET_NAME(SWIFFT_ComputeMultipleSigned128);
+	swifft_hash->SWIFFT_Compute64 = SWIFFT_ISET_NAME(SWIFFT_Compute64);
+	swifft_hash->SWIFFT_ComputeSigned64 = SWIFFT_ISET_NAME(SWIFFT_ComputeSigned64);
+	swifft_hash->SWIFFT_ComputeMultiple64 = SWIFFT_ISET_NAME(SWIFFT_ComputeMultiple64);
+	swifft_hash->SWIFFT_ComputeMultipleSigned64 = SWIFFT_ISET_NAME(SWIFFT_ComputeMultipleSigned64);
+	swifft_hash->SWIFFT_Compute128Keyed = SWIFFT_ISET_NAME(SWIFFT_Compute128Keyed);
+	swifft_hash->SWIFFT_ComputeSigned128Keyed = SWIFFT_ISET_NAME(SWIFFT_ComputeSigned128Keyed);
+	swifft_hash->SWIFFT_ComputeMultiple128Keyed = SWIFFT_ISET_NAME(SWIFFT_ComputeMultiple128Keyed);
+	swifft_hash->SWIFFT_ComputeMultipleSigned128Keyed = SWIFFT_ISET_NAME(SWIFFT_ComputeMultipleSigned128Keyed);
+	swifft_hash->SWIFFT_Compute64Keyed = SWIFFT_ISET_NAME(SWIFFT_Compute64Keyed);
+	swifft_hash->SWIFFT_ComputeSigned64Keyed = SWIFFT_ISET_NAME(SWIFFT_ComputeSigned64Keyed);
+	swifft_hash->SWIFFT_ComputeMultiple64Keyed = SWIFFT_ISET_NAME(SWIFFT_ComputeMultiple64Keyed);
+	swifft_hash->SWIFFT_ComputeMultipleSigned64Keyed = SWIFFT_ISET_NAME(SWIFFT_ComputeMultipleSigned64Keyed);
+	swifft_hash->SWIFFT_ComputeSum = SWIFFT_ISET_NAME(SWIFFT_ComputeSum);
+	swifft_hash->SWIFFT_ComputeSumSigned = SWIFFT_ISET_NAME(SWIFFT_ComputeSumSigned);
+	swifft_hash->SWIFFT_ComputeLinearCombination = SWIFFT_ISET_NAME(SWIFFT_ComputeLinearCombination);
+	swifft_hash->SWIFFT_ComputeLinearCombinationSigned = SWIFFT_ISET_NAME(SWIFFT_ComputeLinearCombinationSigned);
+	swifft_hash->SWIFFT_ComputeSumKeyed = SWIFFT_ISET_NAME(SWIFFT_ComputeSumKeyed);
+	swifft_hash->SWIFFT_ComputeSumSignedKeyed = SWIFFT_ISET_NAME(SWIFFT_ComputeSumSignedKeyed);
+	swifft_hash->SWIFFT_ComputeLinearCombinationKeyed = SWIFFT_ISET_NAME(SWIFFT_ComputeLinearCombinationKeyed);
+	swifft_hash->SWIFFT_ComputeLinearCombinationSignedKeyed = SWIFFT_ISET_NAME(SWIFFT_ComputeLinearCombinationSignedKeyed);
+	swifft_hash->SWIFFT_UpdateBits = SWIFFT_ISET_NAME(SWIFFT_UpdateBits);
+	swifft_hash->SWIFFT_UpdateBitsSigned = SWIFFT_ISET_NAME(SWIFFT_UpdateBitsSigned);
+	swifft_hash->SWIFFT_UpdateBitsMultiple = SWIFFT_ISET_NAME(SWIFFT_UpdateBitsMultiple);
+	swifft_hash->SWIFFT_UpdateBitsMultipleSigned = SWIFFT_ISET_NAME(SWIFFT_UpdateBitsMultipleSigned);
+	swifft_hash->SWIFFT_ComputeSparse = SWIFFT_ISET_NAME(SWIFFT_ComputeSparse);
+	swifft_hash->SWIFFT_ComputeSparseSigned = SWIFFT_ISET_NAME(SWIFFT_ComputeSparseSigned);
+	swifft_hash->SWIFFT_ComputeSparseMultiple = SWIFFT_ISET_NAME(SWIFFT_ComputeSparseMultiple);
+	swifft_hash->SWIFFT_ComputeSparseMultipleSigned = SWIFFT_ISET_NAME(SWIFFT_ComputeSparseMultipleSigned);
 }
 
 void SWIFFT_ISET_NAME(SWIFFT_InitObject)(swifft_object_t *swifft)
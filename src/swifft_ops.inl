@@ -8,6 +8,9 @@
  */
 #include "libswifft/swifft.h"
 #include "swifft_impl.inl"
+#if defined(__AVX__)
+	#include <immintrin.h>
+#endif
 
 #ifndef SWIFFT_LOG2_O
 	#define SWIFFT_LOG2_O (SWIFFT_VECTOR_LOG2_SIZE - 3) ///< Log base-2 of SWIFFT_O
@@ -20,6 +23,36 @@
 //! Number of doublings of the wide SWIFFT vector  - used with the best available instruction set
 #define SWIFFT_O (1 << SWIFFT_LOG2_O)
 
+#if defined(__AVX512BW__) && (SWIFFT_O == 4)
+	//! Whether wide SWIFFT vectors are operated on using AVX512BW mask and lane intrinsics
+	#define SWIFFT_USE_AVX512BW 1
+#else
+	//! Whether wide SWIFFT vectors are operated on using AVX512BW mask and lane intrinsics
+	#define SWIFFT_USE_AVX512BW 0
+#endif
+#if defined(__AVX__) && (SWIFFT_O == 2)
+	//! Whether wide SWIFFT vectors of two 128-bit lanes are operated on using AVX lane intrinsics
+	#define SWIFFT_USE_AVX_LANES 1
+#else
+	//! Whether wide SWIFFT vectors of two 128-bit lanes are operated on using AVX lane intrinsics
+	#define SWIFFT_USE_AVX_LANES 0
+#endif
+#if (defined(__AVX512BW__) && (SWIFFT_O == 4)) || (defined(__AVX2__) && (SWIFFT_O == 2)) || (defined(__AVX__) && (SWIFFT_O == 1))
+	//! Whether wide SWIFFT vectors are multiplied and added into 32-bit elements using multiply-add intrinsics
+	#define SWIFFT_USE_MADD 1
+#else
+	//! Whether wide SWIFFT vectors are multiplied and added into 32-bit elements using multiply-add intrinsics
+	#define SWIFFT_USE_MADD 0
+#endif
+
+#if (defined(__AVX512BW__) && (SWIFFT_O == 4)) || (defined(__AVX2__) && (SWIFFT_O == 2)) || (defined(__AVX__) && (SWIFFT_O == 1))
+	//! Whether elements of wide SWIFFT vectors are interleaved within 128-bit lanes using unpack intrinsics
+	#define SWIFFT_USE_UNPACK 1
+#else
+	//! Whether elements of wide SWIFFT vectors are interleaved within 128-bit lanes using unpack intrinsics
+	#define SWIFFT_USE_UNPACK 0
+#endif
+
 //! Constant SWIFFT vector with all entries set to n
 #define Z1CONST(n) {n,n,n,n,n,n,n,n}
 #if SWIFFT_O == 4
@@ -32,6 +65,64 @@
 	//! Constant wide SWIFFT vector with all entries set to n
 	#define ZOCONST(n) {n,n,n,n,n,n,n,n}
 #endif
+#if SWIFFT_O == 4
+	//! Constant wide SWIFFT vector of 32-bit elements with all entries set to n
+	#define ZDCONST(n) {n,n,n,n,n,n,n,n,n,n,n,n,n,n,n,n}
+#elif SWIFFT_O == 2
+	//! Constant wide SWIFFT vector of 32-bit elements with all entries set to n
+	#define ZDCONST(n) {n,n,n,n,n,n,n,n}
+#elif SWIFFT_O == 1
+	//! Constant wide SWIFFT vector of 32-bit elements with all entries set to n
+	#define ZDCONST(n) {n,n,n,n}
+#endif
+#if SWIFFT_VECTOR_LOG2_SIZE == 5
+	//! Constant native vector of 32-bit elements with all entries set to n
+	#define ZVDCONST(n) {n,n,n,n,n,n,n,n,n,n,n,n,n,n,n,n}
+	//! Constant native vector of 64-bit elements with all entries set to n
+	#define ZVQCONST(n) {n,n,n,n,n,n,n,n}
+	//! Selector of the even, then odd, 64-bit elements of a pair of native vectors
+	#define ZVQEVENS {0,2,4,6,8,10,12,14}
+	#define ZVQODDS {1,3,5,7,9,11,13,15}
+	//! Indices of the 32-bit elements of a native vector
+	#define ZVDINDICES {0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15}
+	//! Indices of the 64-bit elements of a native vector
+	#define ZVQINDICES {0,1,2,3,4,5,6,7}
+	//! Selector interleaving the low, then high, halves of the 64-bit elements of a pair of native vectors
+	#define ZVQLOWS {0,8,1,9,2,10,3,11}
+	#define ZVQHIGHS {4,12,5,13,6,14,7,15}
+#elif SWIFFT_VECTOR_LOG2_SIZE == 4
+	//! Constant native vector of 32-bit elements with all entries set to n
+	#define ZVDCONST(n) {n,n,n,n,n,n,n,n}
+	//! Constant native vector of 64-bit elements with all entries set to n
+	#define ZVQCONST(n) {n,n,n,n}
+	//! Selector of the even, then odd, 64-bit elements of a pair of native vectors
+	#define ZVQEVENS {0,2,4,6}
+	#define ZVQODDS {1,3,5,7}
+	//! Indices of the 32-bit elements of a native vector
+	#define ZVDINDICES {0,1,2,3,4,5,6,7}
+	//! Indices of the 64-bit elements of a native vector
+	#define ZVQINDICES {0,1,2,3}
+	//! Selector interleaving the low, then high, halves of the 64-bit elements of a pair of native vectors
+	#define ZVQLOWS {0,4,1,5}
+	#define ZVQHIGHS {2,6,3,7}
+#elif SWIFFT_VECTOR_LOG2_SIZE == 3
+	//! Constant native vector of 32-bit elements with all entries set to n
+	#define ZVDCONST(n) {n,n,n,n}
+	//! Constant native vector of 64-bit elements with all entries set to n
+	#define ZVQCONST(n) {n,n}
+	//! Selector of the even, then odd, 64-bit elements of a pair of native vectors
+	#define ZVQEVENS {0,2}
+	#define ZVQODDS {1,3}
+	//! Indices of the 32-bit elements of a native vector
+	#define ZVDINDICES {0,1,2,3}
+	//! Indices of the 64-bit elements of a native vector
+	#define ZVQINDICES {0,1}
+	//! Selector interleaving the low, then high, halves of the 64-bit elements of a pair of native vectors
+	#define ZVQLOWS {0,2}
+	#define ZVQHIGHS {1,3}
+#endif
+//! Constant native vector of double-precision elements with all entries set to n
+#define ZVFCONST(n) ZVQCONST(n)
 
 LIBSWIFFT_BEGIN_EXTERN_C
 
@@ -39,6 +130,16 @@ LIBSWIFFT_BEGIN_EXTERN_C
 typedef int16_t Z1vec   __attribute__ ((vector_size (SWIFFT_W*sizeof(int16_t))));
 //! Wide SWIFFT vector type
 typedef int16_t ZOvec   __attribute__ ((vector_size (SWIFFT_O*SWIFFT_W*sizeof(int16_t))));
+//! Wide SWIFFT vector type of 32-bit elements, of the same size as the wide SWIFFT vector type
+typedef int32_t ZOdvec  __attribute__ ((vector_size (SWIFFT_O*SWIFFT_W*sizeof(int16_t))));
+//! Native vector type of 32-bit elements, of the widest size of the instruction set
+typedef int32_t ZVdvec  __attribute__ ((vector_size (SWIFFT_VECTOR_SIZE*sizeof(int16_t))));
+//! Native vector type of unsigned 32-bit elements, of the widest size of the instruction set
+typedef uint32_t ZVuvec __attribute__ ((vector_size (SWIFFT_VECTOR_SIZE*sizeof(int16_t))));
+//! Native vector type of 64-bit elements, of the widest size of the instruction set
+typedef uint64_t ZVqvec __attribute__ ((vector_size (SWIFFT_VECTOR_SIZE*sizeof(int16_t))));
+//! Native vector type of double-precision elements, of the widest size of the instruction set
+typedef double ZVfvec   __attribute__ ((vector_size (SWIFFT_VECTOR_SIZE*sizeof(int16_t))));
 
 
 //! \brief Shift a SWIFFT vector element-wise
@@ -69,9 +170,15 @@ static inline ZOvec SWIFFT_qReduce(ZOvec x) // (x mod 256) - floor(x/256)
 //! \returns the reduced SWIFFT vector.
 static inline ZOvec SWIFFT_modP(ZOvec x)
 {
-	ZOvec ZO_M1 = ZOCONST(-1), ZO_M257 = ZOCONST(-257);
+	ZOvec ZO_M1 = ZOCONST(-1);
 	ZOvec tmp = SWIFFT_qReduce(SWIFFT_qReduce(x));
+#if SWIFFT_USE_AVX512BW
+	ZOvec ZO_256 = ZOCONST(256);
+	return (ZOvec)_mm512_mask_blend_epi16(_mm512_cmpeq_epi16_mask((__m512i)tmp, (__m512i)ZO_M1), (__m512i)tmp, (__m512i)ZO_256);
+#else
+	ZOvec ZO_M257 = ZOCONST(-257);
 	return tmp ^ ((tmp == ZO_M1) & ZO_M257);
+#endif
 }
 
 //! \brief Safely multiply two SWIFFT vectors element-wise in the range [-128..128] * [0..256]
@@ -82,9 +189,390 @@ static inline ZOvec SWIFFT_safeMult(ZOvec v, ZOvec u)
 	ZOvec ZO_256 = ZOCONST(256), ZO_128 = ZOCONST(128);
 	v = SWIFFT_qReduce(v);
 	ZOvec m = v * u;
+#if SWIFFT_USE_AVX512BW
+	ZOvec ZO_1 = ZOCONST(1);
+	__mmask32 overflow = _mm512_cmpeq_epi16_mask((__m512i)v, (__m512i)ZO_256) & _mm512_cmpeq_epi16_mask((__m512i)u, (__m512i)ZO_128);
+	return (ZOvec)_mm512_mask_add_epi16((__m512i)m, overflow, (__m512i)m, (__m512i)ZO_1); // adds 1 on overflow (the case of 256*128)
+#else
 	ZOvec adjust = ((v == ZO_256) & (u == ZO_128)); // inequality returns ~0
 	return m - adjust; // adds 1 on overflow (the case of 256*128), 0 otherwise
+#endif
+}
+
+//! \brief Centers a SWIFFT vector element-wise from the range {-2*128,..,2*128} to {-128,..,128} mod SWIFFT_P.
+//! \param[in] x the SWIFFT vector.
+//! \returns the centered SWIFFT vector.
+static inline ZOvec SWIFFT_centerP(ZOvec x)
+{
+	ZOvec ZO_128 = ZOCONST(128), ZO_M128 = ZOCONST(-128), ZO_257 = ZOCONST(257);
+#if SWIFFT_USE_AVX512BW
+	x = (ZOvec)_mm512_mask_sub_epi16((__m512i)x, _mm512_cmpgt_epi16_mask((__m512i)x, (__m512i)ZO_128), (__m512i)x, (__m512i)ZO_257);
+	return (ZOvec)_mm512_mask_add_epi16((__m512i)x, _mm512_cmplt_epi16_mask((__m512i)x, (__m512i)ZO_M128), (__m512i)x, (__m512i)ZO_257);
+#else
+	x -= (x > ZO_128) & ZO_257;
+	return x + ((x < ZO_M128) & ZO_257);
+#endif
 }
 
+//! \brief Tests whether all elements of a wide SWIFFT vector are zero.
+//! \param[in] x the wide SWIFFT vector.
+//! \returns 1 if all elements are zero, 0 otherwise.
+static inline int SWIFFT_isZeroO(ZOvec x)
+{
+#if SWIFFT_USE_AVX512BW
+	return _mm512_test_epi16_mask((__m512i)x, (__m512i)x) == 0;
+#elif defined(__AVX__) && (SWIFFT_O == 2)
+	return _mm256_testz_si256((__m256i)x, (__m256i)x);
+#elif defined(__AVX__) && (SWIFFT_O == 1)
+	return _mm_testz_si128((__m128i)x, (__m128i)x);
+#else
+	ZOdvec d = (ZOdvec)x;
+	int32_t acc = 0;
+	int j;
+	for (j=0; j<4*SWIFFT_O; j++) {
+		acc |= d[j];
+	}
+	return acc == 0;
+#endif
+}
+
+//! \brief Gathers SWIFFT_O SWIFFT vectors of a table into a wide SWIFFT vector.
+//! The j-th gathered SWIFFT vector is put in the j-th part of the wide SWIFFT vector.
+//! \param[in] Tabl the table of SWIFFT vectors.
+//! \param[in] idx the indices of the SWIFFT vectors to gather.
+//! \returns the wide SWIFFT vector.
+static inline ZOvec SWIFFT_gatherO(const Z1vec *Tabl, const int idx[SWIFFT_O])
+{
+#if SWIFFT_USE_AVX512BW
+	__m256i lo = _mm256_inserti128_si256(_mm256_castsi128_si256((__m128i)Tabl[idx[0]]), (__m128i)Tabl[idx[1]], 1);
+	__m256i hi = _mm256_inserti128_si256(_mm256_castsi128_si256((__m128i)Tabl[idx[2]]), (__m128i)Tabl[idx[3]], 1);
+	return (ZOvec)_mm512_inserti64x4(_mm512_castsi256_si512(lo), hi, 1);
+#elif SWIFFT_USE_AVX_LANES
+	return (ZOvec)_mm256_insertf128_si256(_mm256_castsi128_si256((__m128i)Tabl[idx[0]]), (__m128i)Tabl[idx[1]], 1);
+#else
+	ZOvec r;
+	int j;
+	for (j=0; j<SWIFFT_O; j++) {
+		((Z1vec *)&r)[j] = Tabl[idx[j]];
+	}
+	return r;
+#endif
+}
+
+//! \brief Gathers SWIFFT_O differences of pairs of SWIFFT vectors of a table into a wide SWIFFT vector.
+//! The j-th gathered difference is put in the j-th part of the wide SWIFFT vector.
+//! \param[in] Tabl the table of SWIFFT vectors.
+//! \param[in] idx the indices of the SWIFFT vectors to subtract from.
+//! \param[in] idx2 the indices of the SWIFFT vectors to subtract.
+//! \returns the wide SWIFFT vector.
+static inline ZOvec SWIFFT_gatherDiffO(const Z1vec *Tabl, const int idx[SWIFFT_O], const int idx2[SWIFFT_O])
+{
+#if SWIFFT_USE_AVX512BW
+	__m256i lo = _mm256_inserti128_si256(_mm256_castsi128_si256((__m128i)(Tabl[idx[0]] - Tabl[idx2[0]])), (__m128i)(Tabl[idx[1]] - Tabl[idx2[1]]), 1);
+	__m256i hi = _mm256_inserti128_si256(_mm256_castsi128_si256((__m128i)(Tabl[idx[2]] - Tabl[idx2[2]])), (__m128i)(Tabl[idx[3]] - Tabl[idx2[3]]), 1);
+	return (ZOvec)_mm512_inserti64x4(_mm512_castsi256_si512(lo), hi, 1);
+#elif SWIFFT_USE_AVX_LANES
+	return (ZOvec)_mm256_insertf128_si256(_mm256_castsi128_si256((__m128i)(Tabl[idx[0]] - Tabl[idx2[0]])), (__m128i)(Tabl[idx[1]] - Tabl[idx2[1]]), 1);
+#else
+	ZOvec r;
+	int j;
+	for (j=0; j<SWIFFT_O; j++) {
+		((Z1vec *)&r)[j] = Tabl[idx[j]] - Tabl[idx2[j]];
+	}
+	return r;
+#endif
+}
+
+//! \brief Stores 8 wide SWIFFT vectors transposed in parts of SWIFFT vectors.
+//! The j-th part of the k-th wide SWIFFT vector is stored as the (8*j+k)-th SWIFFT vector.
+//! \param[in] v the 8 wide SWIFFT vectors.
+//! \param[out] out the 8*SWIFFT_O SWIFFT vectors.
+static inline void SWIFFT_storeTransposedO(const ZOvec v[8], Z1vec *out)
+{
+#if SWIFFT_USE_AVX512BW
+	int g;
+	__m512i *zout = (__m512i *)out;
+	for (g=0; g<2; g++,v+=4,zout++) {
+		// transposing a 4x4 matrix of 128-bit lanes
+		__m512i a0 = _mm512_shuffle_i64x2((__m512i)v[0], (__m512i)v[1], _MM_SHUFFLE(1,0,1,0));
+		__m512i a1 = _mm512_shuffle_i64x2((__m512i)v[0], (__m512i)v[1], _MM_SHUFFLE(3,2,3,2));
+		__m512i a2 = _mm512_shuffle_i64x2((__m512i)v[2], (__m512i)v[3], _MM_SHUFFLE(1,0,1,0));
+		__m512i a3 = _mm512_shuffle_i64x2((__m512i)v[2], (__m512i)v[3], _MM_SHUFFLE(3,2,3,2));
+		zout[0] = _mm512_shuffle_i64x2(a0, a2, _MM_SHUFFLE(2,0,2,0));
+		zout[2] = _mm512_shuffle_i64x2(a0, a2, _MM_SHUFFLE(3,1,3,1));
+		zout[4] = _mm512_shuffle_i64x2(a1, a3, _MM_SHUFFLE(2,0,2,0));
+		zout[6] = _mm512_shuffle_i64x2(a1, a3, _MM_SHUFFLE(3,1,3,1));
+	}
+#elif SWIFFT_USE_AVX_LANES
+	int k;
+	__m256i *yout = (__m256i *)out;
+	for (k=0; k<8; k+=2,v+=2,yout++) {
+		// transposing a 2x2 matrix of 128-bit lanes
+		yout[0] = _mm256_permute2f128_si256((__m256i)v[0], (__m256i)v[1], 0x20);
+		yout[4] = _mm256_permute2f128_si256((__m256i)v[0], (__m256i)v[1], 0x31);
+	}
+#else
+	int j,k;
+	for (j=0; j<SWIFFT_O; j++,out+=8) {
+		for (k=0; k<8; k++) {
+			out[k] = ((const Z1vec *)&v[k])[j];
+		}
+	}
+#endif
+}
+
+#if SWIFFT_USE_UNPACK && (SWIFFT_O == 4)
+	#define SWIFFT_UNPACK(lohi,bits,a,b) (ZOvec)_mm512_unpack##lohi##_epi##bits((__m512i)(a), (__m512i)(b))
+#elif SWIFFT_USE_UNPACK && (SWIFFT_O == 2)
+	#define SWIFFT_UNPACK(lohi,bits,a,b) (ZOvec)_mm256_unpack##lohi##_epi##bits((__m256i)(a), (__m256i)(b))
+#elif SWIFFT_USE_UNPACK && (SWIFFT_O == 1)
+	#define SWIFFT_UNPACK(lohi,bits,a,b) (ZOvec)_mm_unpack##lohi##_epi##bits((__m128i)(a), (__m128i)(b))
+#endif
+
+//! \brief Transposes the 8x8 matrix of elements in each part of 8 wide SWIFFT vectors.
+//! The i-th element of the j-th part of the k-th wide SWIFFT vector is swapped with the k-th element of the j-th part of the i-th one.
+//! \param[in,out] v the 8 wide SWIFFT vectors.
+static inline void SWIFFT_transposeO(ZOvec v[8])
+{
+#if SWIFFT_USE_UNPACK
+	ZOvec t[8], u[8];
+	int k;
+	for (k=0; k<8; k+=2) {
+		t[k] = SWIFFT_UNPACK(lo, 16, v[k], v[k+1]);
+		t[k+1] = SWIFFT_UNPACK(hi, 16, v[k], v[k+1]);
+	}
+	for (k=0; k<8; k+=4) {
+		u[k] = SWIFFT_UNPACK(lo, 32, t[k], t[k+2]);
+		u[k+1] = SWIFFT_UNPACK(hi, 32, t[k], t[k+2]);
+		u[k+2] = SWIFFT_UNPACK(lo, 32, t[k+1], t[k+3]);
+		u[k+3] = SWIFFT_UNPACK(hi, 32, t[k+1], t[k+3]);
+	}
+	for (k=0; k<4; k++) {
+		v[2*k] = SWIFFT_UNPACK(lo, 64, u[k], u[k+4]);
+		v[2*k+1] = SWIFFT_UNPACK(hi, 64, u[k], u[k+4]);
+	}
+#else
+	int i,j,k;
+	for (j=0; j<SWIFFT_O; j++) {
+		for (k=0; k<8; k++) {
+			for (i=k+1; i<8; i++) {
+				int16_t tmp = v[k][8*j+i];
+				v[k][8*j+i] = v[i][8*j+k];
+				v[i][8*j+k] = tmp;
+			}
+		}
+	}
+#endif
+}
+
+//! \brief Multiplies two pairs of wide SWIFFT vectors element-wise and accumulates the sums of the pairs of products into 32-bit elements.
+//! The sums for the low (resp. high) half of the elements of each 8-element part are accumulated into acc[0] (resp. acc[1]).
+//! \param[in,out] acc the two wide SWIFFT vectors of 32-bit elements to accumulate into.
+//! \param[in] a0 the first SWIFFT vector of the first pair.
+//! \param[in] a1 the first SWIFFT vector of the second pair.
+//! \param[in] b0 the second SWIFFT vector of the first pair.
+//! \param[in] b1 the second SWIFFT vector of the second pair.
+static inline void SWIFFT_maddPairO(ZOdvec acc[2], ZOvec a0, ZOvec a1, ZOvec b0, ZOvec b1)
+{
+#if SWIFFT_USE_MADD && (SWIFFT_O == 4)
+	__m512i alo = _mm512_unpacklo_epi16((__m512i)a0, (__m512i)a1), ahi = _mm512_unpackhi_epi16((__m512i)a0, (__m512i)a1);
+	__m512i blo = _mm512_unpacklo_epi16((__m512i)b0, (__m512i)b1), bhi = _mm512_unpackhi_epi16((__m512i)b0, (__m512i)b1);
+	acc[0] += (ZOdvec)_mm512_madd_epi16(alo, blo);
+	acc[1] += (ZOdvec)_mm512_madd_epi16(ahi, bhi);
+#elif SWIFFT_USE_MADD && (SWIFFT_O == 2)
+	__m256i alo = _mm256_unpacklo_epi16((__m256i)a0, (__m256i)a1), ahi = _mm256_unpackhi_epi16((__m256i)a0, (__m256i)a1);
+	__m256i blo = _mm256_unpacklo_epi16((__m256i)b0, (__m256i)b1), bhi = _mm256_unpackhi_epi16((__m256i)b0, (__m256i)b1);
+	acc[0] += (ZOdvec)_mm256_madd_epi16(alo, blo);
+	acc[1] += (ZOdvec)_mm256_madd_epi16(ahi, bhi);
+#elif SWIFFT_USE_MADD && (SWIFFT_O == 1)
+	__m128i alo = _mm_unpacklo_epi16((__m128i)a0, (__m128i)a1), ahi = _mm_unpackhi_epi16((__m128i)a0, (__m128i)a1);
+	__m128i blo = _mm_unpacklo_epi16((__m128i)b0, (__m128i)b1), bhi = _mm_unpackhi_epi16((__m128i)b0, (__m128i)b1);
+	acc[0] += (ZOdvec)_mm_madd_epi16(alo, blo);
+	acc[1] += (ZOdvec)_mm_madd_epi16(ahi, bhi);
+#else
+	int h,j,e;
+	for (h=0; h<2; h++) {
+		for (j=0; j<SWIFFT_O; j++) {
+			for (e=0; e<4; e++) {
+				int k = 8*j + 4*h + e;
+				acc[h][4*j+e] += (int32_t)a0[k] * b0[k] + (int32_t)a1[k] * b1[k];
+			}
+		}
+	}
+#endif
+}
+
+//! \brief Multiplies a pair of wide SWIFFT vectors by a pair of constants and accumulates the sums of the pairs of products into 32-bit elements.
+//! Same as SWIFFT_maddPairO with constant second vectors, but with the constants already interleaved,
+//! so that an interleaved pair of 16-bit constants stored in memory is broadcast by a single 32-bit load.
+//! \param[in,out] acc the two wide SWIFFT vectors of 32-bit elements to accumulate into.
+//! \param[in] a0 the SWIFFT vector to multiply by the first constant.
+//! \param[in] a1 the SWIFFT vector to multiply by the second constant.
+//! \param[in] c the pair of constants, in the low and high 16-bit halves of each 32-bit element.
+static inline void SWIFFT_maddConstPairO(ZOdvec acc[2], ZOvec a0, ZOvec a1, ZOvec c)
+{
+#if SWIFFT_USE_MADD && (SWIFFT_O == 4)
+	__m512i alo = _mm512_unpacklo_epi16((__m512i)a0, (__m512i)a1), ahi = _mm512_unpackhi_epi16((__m512i)a0, (__m512i)a1);
+	acc[0] += (ZOdvec)_mm512_madd_epi16(alo, (__m512i)c);
+	acc[1] += (ZOdvec)_mm512_madd_epi16(ahi, (__m512i)c);
+#elif SWIFFT_USE_MADD && (SWIFFT_O == 2)
+	__m256i alo = _mm256_unpacklo_epi16((__m256i)a0, (__m256i)a1), ahi = _mm256_unpackhi_epi16((__m256i)a0, (__m256i)a1);
+	acc[0] += (ZOdvec)_mm256_madd_epi16(alo, (__m256i)c);
+	acc[1] += (ZOdvec)_mm256_madd_epi16(ahi, (__m256i)c);
+#elif SWIFFT_USE_MADD && (SWIFFT_O == 1)
+	__m128i alo = _mm_unpacklo_epi16((__m128i)a0, (__m128i)a1), ahi = _mm_unpackhi_epi16((__m128i)a0, (__m128i)a1);
+	acc[0] += (ZOdvec)_mm_madd_epi16(alo, (__m128i)c);
+	acc[1] += (ZOdvec)_mm_madd_epi16(ahi, (__m128i)c);
+#else
+	int h,j,e;
+	for (h=0; h<2; h++) {
+		for (j=0; j<SWIFFT_O; j++) {
+			for (e=0; e<4; e++) {
+				int k = 8*j + 4*h + e;
+				acc[h][4*j+e] += (int32_t)a0[k] * c[0] + (int32_t)a1[k] * c[1];
+			}
+		}
+	}
+#endif
+}
+
+//! \brief Reduces a wide SWIFFT vector of 32-bit elements element-wise mod-257 to the range {-2*255-128,..,2*255+127}
+//! \param[in] x the wide SWIFFT vector of 32-bit elements.
+//! \returns the reduced wide SWIFFT vector of 32-bit elements.
+static inline ZOdvec SWIFFT_dReduce(ZOdvec x)
+{
+	ZOdvec ZD_255 = ZDCONST(255), ZD_8 = ZDCONST(8), ZD_16 = ZDCONST(16), ZD_24 = ZDCONST(24);
+	// since 2^8 = -1 mod 257
+	return (x & ZD_255) - ((x >> ZD_8) & ZD_255) + ((x >> ZD_16) & ZD_255) - (x >> ZD_24);
+}
+
+//! \brief Reduces two wide SWIFFT vectors of 32-bit elements, accumulated by SWIFFT_maddPairO, mod-257 into a wide SWIFFT vector in the range {-2*255-128,..,2*255+127}
+//! \param[in] acc the two wide SWIFFT vectors of 32-bit elements.
+//! \returns the reduced wide SWIFFT vector.
+static inline ZOvec SWIFFT_packReduce(const ZOdvec acc[2])
+{
+	ZOdvec r[2];
+	int h;
+	for (h=0; h<2; h++) {
+		r[h] = SWIFFT_dReduce(acc[h]);
+	}
+#if SWIFFT_USE_MADD && (SWIFFT_O == 4)
+	return (ZOvec)_mm512_packs_epi32((__m512i)r[0], (__m512i)r[1]);
+#elif SWIFFT_USE_MADD && (SWIFFT_O == 2)
+	return (ZOvec)_mm256_packs_epi32((__m256i)r[0], (__m256i)r[1]);
+#elif SWIFFT_USE_MADD && (SWIFFT_O == 1)
+	return (ZOvec)_mm_packs_epi32((__m128i)r[0], (__m128i)r[1]);
+#else
+	ZOvec x;
+	int j,e;
+	for (h=0; h<2; h++) {
+		for (j=0; j<SWIFFT_O; j++) {
+			for (e=0; e<4; e++) {
+				x[8*j + 4*h + e] = (int16_t)r[h][4*j+e];
+			}
+		}
+	}
+	return x;
+#endif
+}
+
+//! \brief Merges pairs of adjacent base-257 digits of 16-bit elements, least significant first, into base-257^2 digits of 32-bit elements.
+//! Each pair is multiplied-and-added with the multipliers 1 and 257.
+//! \param[in] d the native vector of base-257 digits, in the range {0,..,256}, as pairs in 32-bit elements.
+//! \returns the native vector of base-257^2 digits.
+static inline ZVdvec SWIFFT_mergeDigitsV(ZVdvec d)
+{
+#if defined(__AVX512BW__) && (SWIFFT_VECTOR_LOG2_SIZE == 5)
+	return (ZVdvec)_mm512_madd_epi16((__m512i)d, _mm512_set1_epi32(SWIFFT_P << 16 | 1));
+#elif defined(__AVX2__) && (SWIFFT_VECTOR_LOG2_SIZE == 4)
+	return (ZVdvec)_mm256_madd_epi16((__m256i)d, _mm256_set1_epi32(SWIFFT_P << 16 | 1));
+#elif defined(__AVX__) && (SWIFFT_VECTOR_LOG2_SIZE == 3)
+	return (ZVdvec)_mm_madd_epi16((__m128i)d, _mm_set1_epi32(SWIFFT_P << 16 | 1));
+#else
+	// 257 = 2^8+1
+	ZVdvec ZD_0xffff = ZVDCONST(0xffff), ZD_8 = ZVDCONST(8), ZD_16 = ZVDCONST(16);
+	ZVdvec h = d >> ZD_16;
+	return (d & ZD_0xffff) + (h << ZD_8) + h;
+#endif
+}
+
+//! \brief Merges pairs of adjacent base-257^2 digits of 32-bit elements, least significant first, into base-257^4 digits of 64-bit elements.
+//! \param[in] e the native vector of base-257^2 digits, as pairs in 64-bit elements.
+//! \returns the native vector of base-257^4 digits.
+static inline ZVqvec SWIFFT_mergeDigits2V(ZVqvec e)
+{
+	ZVqvec ZQ_0xffffffff = ZVQCONST(0xffffffff), ZQ_32 = ZVQCONST(32);
+#if defined(__AVX512F__) && (SWIFFT_VECTOR_LOG2_SIZE == 5)
+	return (e & ZQ_0xffffffff) + (ZVqvec)_mm512_mul_epu32((__m512i)(e >> ZQ_32), _mm512_set1_epi64(SWIFFT_P*SWIFFT_P));
+#elif defined(__AVX2__) && (SWIFFT_VECTOR_LOG2_SIZE == 4)
+	return (e & ZQ_0xffffffff) + (ZVqvec)_mm256_mul_epu32((__m256i)(e >> ZQ_32), _mm256_set1_epi64x(SWIFFT_P*SWIFFT_P));
+#elif defined(__AVX__) && (SWIFFT_VECTOR_LOG2_SIZE == 3)
+	return (e & ZQ_0xffffffff) + (ZVqvec)_mm_mul_epu32((__m128i)(e >> ZQ_32), _mm_set1_epi64x(SWIFFT_P*SWIFFT_P));
+#else
+	// 257^2 = 2^16+2^9+1
+	ZVqvec ZQ_9 = ZVQCONST(9), ZQ_16 = ZVQCONST(16);
+	ZVqvec g = e >> ZQ_32;
+	return (e & ZQ_0xffffffff) + (g << ZQ_16) + (g << ZQ_9) + g;
+#endif
+}
+
+//! \brief Converts a native vector of 64-bit elements in the range {0,..,2^52-1} to double-precision elements.
+//! \param[in] x the native vector of 64-bit elements.
+//! \returns the native vector of double-precision elements.
+static inline ZVfvec SWIFFT_toDoubleV(ZVqvec x)
+{
+	// the elements become the mantissa of 2^52 + x
+	const ZVqvec ZQ_2P52 = ZVQCONST(0x4330000000000000ULL);
+	const ZVfvec ZF_2P52 = ZVFCONST(4503599627370496.0);
+	return (ZVfvec)(x | ZQ_2P52) - ZF_2P52;
+}
+
+//! \brief Rounds a native vector of double-precision elements in the range [0,2^52) to the nearest 64-bit elements.
+//! \param[in] x the native vector of double-precision elements.
+//! \returns the native vector of 64-bit elements.
+static inline ZVqvec SWIFFT_roundV(ZVfvec x)
+{
+	// adding 2^52 rounds to the nearest integer, which becomes the mantissa
+	const ZVqvec ZQ_2P52 = ZVQCONST(0x4330000000000000ULL);
+	const ZVfvec ZF_2P52 = ZVFCONST(4503599627370496.0);
+	return (ZVqvec)(x + ZF_2P52) - ZQ_2P52;
+}
+
+//! \brief Splits base-257^4 digits of 64-bit elements into pairs of adjacent base-257^2 digits of 32-bit elements, least significant first.
+//! This is the inverse of SWIFFT_mergeDigits2V. The quotient by 257^2 is estimated in double-precision, off by at most one, and then corrected.
+//! \param[in] e the native vector of base-257^4 digits.
+//! \returns the native vector of base-257^2 digits, as pairs in 64-bit elements.
+static inline ZVqvec SWIFFT_splitDigits2V(ZVqvec e)
+{
+	const ZVqvec ZQ_63 = ZVQCONST(63), ZQ_32 = ZVQCONST(32), ZQ_9 = ZVQCONST(9), ZQ_16 = ZVQCONST(16);
+	const ZVqvec ZQ_P2 = ZVQCONST(SWIFFT_P*SWIFFT_P);
+	const ZVfvec ZF_INV_P2 = ZVFCONST(1.0/(SWIFFT_P*SWIFFT_P));
+	ZVqvec g = SWIFFT_roundV(SWIFFT_toDoubleV(e) * ZF_INV_P2);
+	// 257^2 = 2^16+2^9+1
+	ZVqvec r = e - ((g << ZQ_16) + (g << ZQ_9) + g);
+	ZVqvec negative = -(r >> ZQ_63);
+	g += negative;
+	r += negative & ZQ_P2;
+	return (g << ZQ_32) | r;
+}
+
+//! \brief Splits base-257^2 digits of 32-bit elements into pairs of adjacent base-257 digits of 16-bit elements, least significant first.
+//! This is the inverse of SWIFFT_mergeDigitsV. Since 2^8 = -1 mod 257, a digit x = 256*a+b has the remainder b-a mod 257,
+//! which is brought to the range {0,..,SWIFFT_P-1} by at most two corrections, each decrementing the quotient a.
+//! \param[in] g the native vector of base-257^2 digits.
+//! \returns the native vector of base-257 digits, as pairs in 32-bit elements.
+static inline ZVdvec SWIFFT_splitDigitsV(ZVdvec g)
+{
+	const ZVdvec ZD_8 = ZVDCONST(8), ZD_16 = ZVDCONST(16), ZD_31 = ZVDCONST(31), ZD_255 = ZVDCONST(255), ZD_257 = ZVDCONST(257);
+	ZVdvec a = g >> ZD_8;
+	ZVdvec r = (g & ZD_255) - a;
+	ZVdvec negative = r >> ZD_31;
+	a += negative;
+	r += negative & ZD_257;
+	negative = r >> ZD_31;
+	a += negative;
+	r += negative & ZD_257;
+	return (a << ZD_16) | r;
+}
 
 LIBSWIFFT_END_EXTERN_C
@@ -7,7 +7,9 @@
  * \brief LibSWIFFT Catch2 test cases
  */
 #include <iostream>
+#include <limits>
 #include <sstream>
+#include <vector>
 #include <stdlib.h>
 #include <time.h>
 #include <unistd.h>
@@ -48,6 +50,8 @@ TEST_CASE( "rdtsc takes at most 200 cycles on average", "[swifft]" ) {
 TEST_CASE( "swifft block sizes are sane", "[swifft]" ) {
 	REQUIRE( SWIFFT_INPUT_BLOCK_SIZE == 4 * SWIFFT_COMPACT_BLOCK_SIZE );
 	REQUIRE( sizeof(SwifftInput) == 4 * sizeof(SwifftCompact) );
+	REQUIRE( SWIFFT_KEY_SIZE == SWIFFT_M * SWIFFT_N );
+	REQUIRE( SWIFFT_KEY_LAYOUTS == SWIFFT_MAX_LOG2_O + 1 );
 }
 
 static void randomize(SwifftInput * input, size_t size) {
@@ -60,7 +64,8 @@ static void randomize(SwifftInput * input, size_t size) {
 }
 
 template<class Callable>
-static void test_swifft_iter_cycles(int nrepeats, int niters, double cycles_per_iter_limit, const char * iterobj, const Callable & callable) {
+static void test_swifft_iter_cycles(int nrepeats, int niters, double cycles_per_iter_limit, const char * iterobj, const Callable & callable,
+		size_t bytes_per_iter = SWIFFT_INPUT_BLOCK_SIZE, double ops_per_iter = 0) {
 	uint64_t cycles_per_rdtsc = rdtsc_cycles();
 	timespec ts0;
 	clock_gettime(CLOCK_REALTIME, &ts0);
@@ -73,19 +78,34 @@ static void test_swifft_iter_cycles(int nrepeats, int niters, double cycles_per_
 	clock_gettime(CLOCK_REALTIME, &ts1);
 	double dts_sec = ts1.tv_sec - ts0.tv_sec + (ts1.tv_nsec - ts0.tv_nsec) / 1.0e9;
 	double cycles_per_iter = 1.0 * dt / nrepeats / niters,
-	       cycles_per_byte = cycles_per_iter / SWIFFT_INPUT_BLOCK_SIZE,
-	       MBps = 1.0 * SWIFFT_INPUT_BLOCK_SIZE * nrepeats * niters / 1024.0 / 1024.0 / dts_sec,
+	       cycles_per_byte = cycles_per_iter / bytes_per_iter,
+	       MBps = 1.0 * bytes_per_iter * nrepeats * niters / 1024.0 / 1024.0 / dts_sec,
 	       gcps = 1.0 * dt / dts_sec / 1.0e9;
 	std::cerr << "running " << nrepeats << "*" << niters << " " << iterobj << ":"
 	       << " cycles/" << iterobj << "=" << cycles_per_iter
 	       << " cycles/byte=" << cycles_per_byte
 	       << " Giga-cycles/sec=" << gcps
 	       << " MB/sec=" << MBps
-	       << " cycles/rdtsc=" << cycles_per_rdtsc
-	       << std::endl;
+	       << " cycles/rdtsc=" << cycles_per_rdtsc;
+	if (ops_per_iter > 0) {
+		std::cerr << " GOPS=" << ops_per_iter * nrepeats * niters / dts_sec / 1.0e9;
+	}
+	std::cerr << std::endl;
 	REQUIRE( cycles_per_iter < cycles_per_iter_limit );
 }
 
+template<class Callable>
+static void for_each_supported_iset(const Callable & callable) {
+	for (int iset=SWIFFT_ISET_AVX; iset<=SWIFFT_ISET_AVX512BW; iset++) {
+		swifft_object_t swifft;
+		if (SWIFFT_InitIsetObject(&swifft, (swifft_iset_t)iset) != 0) {
+			continue;
+		}
+		CAPTURE( SWIFFT_GetIsetName((swifft_iset_t)iset) );
+		callable(swifft, (swifft_iset_t)iset);
+	}
+}
+
 TEST_CASE( "swifft takes at most 2000 cycles per call", "[.][swifftperf]" ) {
 	swifft_object_t swifft;
 	SWIFFT_InitObject(&swifft);
@@ -103,6 +123,66 @@ TEST_CASE( "swifft takes at most 2000 cycles per call", "[.][swifftperf]" ) {
 	});
 }
 
+TEST_CASE( "swifft with a given key takes at most 2000 cycles per call", "[.][swifftperf]" ) {
+	swifft_object_t swifft;
+	SWIFFT_InitObject(&swifft);
+	srand(1);
+	SwifftInput input = {0};
+	SwifftOutput output = {0};
+	randomize(&input, 1);
+	std::vector<int16_t> values(SWIFFT_KEY_SIZE);
+	for (int j=0; j<SWIFFT_KEY_SIZE; j++) {
+		values[j] = (int16_t)rand();
+	}
+	swifft_key_t *key = SWIFFT_KeyAlloc(1, 0);
+	SWIFFT_KeyInit(key, values.data());
+	int nrepeats = 1, nrounds = 10000000;
+	test_swifft_iter_cycles(nrepeats, nrounds, 2000, "keyed-rounds", [&swifft, &input, &output, key, nrepeats, nrounds]() {
+		for (int r=0; r<nrepeats; r++) {
+			for (int64_t i=0; i<nrounds; i++) {
+				swifft.hash.SWIFFT_ComputeKeyed(key, input.data, output.data);
+			}
+		}
+	});
+	SWIFFT_KeyFree(key);
+}
+
+TEST_CASE( "swifft key derivation takes at most 20000 cycles per call", "[.][swifftperf]" ) {
+	swifft_object_t swifft;
+	SWIFFT_InitObject(&swifft);
+	BitSequence seed[SWIFFT_KEY_SEED_SIZE] = {0};
+	swifft_key_t *key = SWIFFT_KeyAlloc(1, 0);
+	int nrepeats = 1, nrounds = 100000;
+	test_swifft_iter_cycles(nrepeats, nrounds, 20000, "derive-key-rounds", [&swifft, &seed, key, nrepeats, nrounds]() {
+		for (int r=0; r<nrepeats; r++) {
+			for (int64_t i=0; i<nrounds; i++) {
+				seed[0] = (BitSequence)i;
+				swifft.hash.SWIFFT_DeriveKey(seed, key);
+			}
+		}
+	});
+	SWIFFT_KeyFree(key);
+}
+
+TEST_CASE( "swifft signed takes at most 2000 cycles per call", "[.][swifftperf]" ) {
+	swifft_object_t swifft;
+	SWIFFT_InitObject(&swifft);
+	srand(1);
+	SwifftInput input = {0};
+	SwifftInput sign = {0};
+	SwifftOutput output = {0};
+	randomize(&input, 1);
+	randomize(&sign, 1);
+	int nrepeats = 1, nrounds = 10000000;
+	test_swifft_iter_cycles(nrepeats, nrounds, 2000, "signed-rounds", [&swifft, &input, &sign, &output, nrepeats, nrounds]() {
+		for (int r=0; r<nrepeats; r++) {
+			for (int64_t i=0; i<nrounds; i++) {
+				swifft.hash.SWIFFT_ComputeSigned(input.data, sign.data, output.data);
+			}
+		}
+	});
+}
+
 template <class T>
 struct Array
 {
@@ -117,6 +197,54 @@ struct Array
 	}
 };
 
+template<size_t input_block_size, class Callable>
+static void test_swifft_short_input_cycles(int cycles_limit, const char * iterobj, const Callable & compute) {
+	swifft_object_t swifft;
+	SWIFFT_InitObject(&swifft);
+	srand(1);
+	SwifftInput input = {0};
+	SwifftInput sign = {0};
+	SwifftOutput output = {0};
+	randomize(&input, 1);
+	randomize(&sign, 1);
+	int nrepeats = 1, nrounds = 10000000;
+	test_swifft_iter_cycles(nrepeats, nrounds, cycles_limit, iterobj, [&swifft, &input, &sign, &output, &compute, nrepeats, nrounds]() {
+		for (int r=0; r<nrepeats; r++) {
+			for (int64_t i=0; i<nrounds; i++) {
+				compute(swifft.hash, input.data, sign.data, output.data);
+			}
+		}
+	}, input_block_size);
+}
+
+TEST_CASE( "swifft on 128-byte input takes at most 1000 cycles per call", "[.][swifftperf]" ) {
+	test_swifft_short_input_cycles<SWIFFT_INPUT_BLOCK_SIZE_128>(1000, "128-byte-rounds",
+		[](const swifft_hash_object_t &hash, const BitSequence *input, const BitSequence *, BitSequence *output) {
+			hash.SWIFFT_Compute128(input, output);
+		});
+}
+
+TEST_CASE( "swifft signed on 128-byte input takes at most 1000 cycles per call", "[.][swifftperf]" ) {
+	test_swifft_short_input_cycles<SWIFFT_INPUT_BLOCK_SIZE_128>(1000, "128-byte-signed-rounds",
+		[](const swifft_hash_object_t &hash, const BitSequence *input, const BitSequence *sign, BitSequence *output) {
+			hash.SWIFFT_ComputeSigned128(input, sign, output);
+		});
+}
+
+TEST_CASE( "swifft on 64-byte input takes at most 500 cycles per call", "[.][swifftperf]" ) {
+	test_swifft_short_input_cycles<SWIFFT_INPUT_BLOCK_SIZE_64>(500, "64-byte-rounds",
+		[](const swifft_hash_object_t &hash, const BitSequence *input, const BitSequence *, BitSequence *output) {
+			hash.SWIFFT_Compute64(input, output);
+		});
+}
+
+TEST_CASE( "swifft signed on 64-byte input takes at most 500 cycles per call", "[.][swifftperf]" ) {
+	test_swifft_short_input_cycles<SWIFFT_INPUT_BLOCK_SIZE_64>(500, "64-byte-signed-rounds",
+		[](const swifft_hash_object_t &hash, const BitSequence *input, const BitSequence *sign, BitSequence *output) {
+			hash.SWIFFT_ComputeSigned64(input, sign, output);
+		});
+}
+
 #ifdef _OPENMP
 	#define LABEL_OPENMP "(OpenMP)"
 #else
@@ -169,6 +297,27 @@ TEST_CASE( "swifft compact takes at most 150 cycles per call", "[.][swifftperf]"
 	});
 }
 
+TEST_CASE( "swifft decompact takes at most 150 cycles per call", "[.][swifftperf]" ) {
+	swifft_object_t swifft;
+	SWIFFT_InitObject(&swifft);
+	srand(1);
+	SwifftInput input = {0};
+	SwifftOutput output;
+	SwifftCompact compact;
+	BitSequence carry[SWIFFT_COMPACT_CARRY_SIZE];
+	randomize(&input, 1);
+	SWIFFT_Compute(input.data, output.data);
+	SWIFFT_CompactWithCarry(output.data, compact.data, carry);
+	int nrepeats = 1, nrounds=100000;
+	test_swifft_iter_cycles(nrepeats, nrounds, 150, "decompact-rounds", [&swifft, &output, &compact, &carry, nrepeats, nrounds]() {
+		for (int r=0; r<nrepeats; r++) {
+			for (int64_t i=0; i<nrounds; i++) {
+				swifft.hash.SWIFFT_Decompact(compact.data, carry, output.data);
+			}
+		}
+	});
+}
+
 TEST_CASE( "swifft FFT-only takes at most 1500 cycles per call", "[.][swifftperf]" ) {
 	swifft_object_t swifft;
 	SWIFFT_InitObject(&swifft);
@@ -207,6 +356,152 @@ TEST_CASE( "swifft FFT-sum-only takes at most 500 cycles per call", "[.][swifftp
 	});
 }
 
+TEST_CASE( "swifft bit update of 8 bits takes at most 200 cycles per call", "[.][swifftperf]" ) {
+	swifft_object_t swifft;
+	SWIFFT_InitObject(&swifft);
+	srand(1);
+	SwifftInput input[2];
+	SwifftOutput output;
+	randomize(input, 2);
+	int positions[8];
+	for (int j=0; j<8; j++) {
+		positions[j] = j * 257;
+		input[1].data[positions[j] >> 3] = input[0].data[positions[j] >> 3] ^ (1 << (positions[j] & 7));
+	}
+	SWIFFT_Compute(input[0].data, output.data);
+	int nrepeats = 1, nrounds=1000000;
+	test_swifft_iter_cycles(nrepeats, nrounds, 200, "updates", [&swifft, &input, &output, &positions, nrepeats, nrounds]() {
+		for (int r=0; r<nrepeats; r++) {
+			for (int64_t i=0; i<nrounds; i++) {
+				// alternating between the inputs
+				swifft.hash.SWIFFT_UpdateBits(output.data, 8, positions, input[i & 1].data, input[(i + 1) & 1].data);
+			}
+		}
+	});
+}
+
+TEST_CASE( "swifft sparse input of 32 nonzero bits takes at most 200 cycles per call", "[.][swifftperf]" ) {
+	swifft_object_t swifft;
+	SWIFFT_InitObject(&swifft);
+	srand(1);
+	SwifftOutput output;
+	int indices[32];
+	for (int j=0; j<32; j++) {
+		indices[j] = j * 61;
+	}
+	int nrepeats = 1, nrounds=1000000;
+	test_swifft_iter_cycles(nrepeats, nrounds, 200, "rounds", [&swifft, &indices, &output, nrepeats, nrounds]() {
+		for (int r=0; r<nrepeats; r++) {
+			for (int64_t i=0; i<nrounds; i++) {
+				swifft.hash.SWIFFT_ComputeSparse(32, indices, output.data);
+			}
+		}
+	});
+}
+
+TEST_CASE( "swifft matrix multiplication of outputs takes at most 10 cycles per term", "[.][swifftperf]" ) {
+	swifft_object_t swifft;
+	SWIFFT_InitObject(&swifft);
+	srand(1);
+	const int k = 1024, n = 1024;
+	Array<SwifftInput> input(n);
+	Array<SwifftOutput> operand(n);
+	Array<SwifftOutput> output(k);
+	std::vector<int16_t> matrix((size_t)k * n);
+	randomize(input.array, n);
+	SWIFFT_ComputeMultiple(n, input.array[0].data, operand.array[0].data);
+	for (size_t i=0; i<matrix.size(); i++) {
+		matrix[i] = (int16_t)rand();
+	}
+	int nrepeats = 10;
+	// a term is a multiply-add of a coefficient by a hash value, of SWIFFT_N elements each counted as 2 operations
+	test_swifft_iter_cycles(nrepeats, k * n, 10, "terms", [&swifft, &matrix, &operand, &output, nrepeats, k, n]() {
+		for (int r=0; r<nrepeats; r++) {
+			swifft.arith.SWIFFT_MatMulOutputs(k, n, matrix.data(), operand.array[0].data, output.array[0].data);
+		}
+	}, SWIFFT_OUTPUT_BLOCK_SIZE, 2.0 * SWIFFT_N);
+}
+
+TEST_CASE( "swifft search of outputs takes at most 50 cycles per block", "[.][swifftperf]" ) {
+	swifft_object_t swifft;
+	SWIFFT_InitObject(&swifft);
+	srand(1);
+	const int n = 1024;
+	Array<SwifftInput> input(n);
+	Array<SwifftOutput> haystack(n);
+	SwifftOutput needle;
+	randomize(input.array, n);
+	SWIFFT_ComputeMultiple(n, input.array[0].data, haystack.array[0].data);
+	needle = haystack.array[n-1];
+	SWIFFT_ConstAdd(needle.data, 1);
+	int nrepeats = 1000;
+	// the needle is not found, so each search compares against all the blocks
+	test_swifft_iter_cycles(nrepeats, n, 50, "blocks", [&swifft, &haystack, &needle, nrepeats, n]() {
+		for (int r=0; r<nrepeats; r++) {
+			REQUIRE( swifft.arith.SWIFFT_FindMatch(n, haystack.array[0].data, needle.data) == -1 );
+		}
+	}, SWIFFT_OUTPUT_BLOCK_SIZE);
+}
+
+TEST_CASE( "swifft multiple blocks with multiple keys takes at most 500 cycles per block and key", "[.][swifftperf]" ) {
+	swifft_object_t swifft;
+	SWIFFT_InitObject(&swifft);
+	srand(1);
+	const int nblocks = 16, nkeys = 16;
+	Array<SwifftInput> input(nblocks);
+	Array<SwifftOutput> output(nblocks*nkeys);
+	randomize(input.array, nblocks);
+	swifft_key_t *keys = SWIFFT_KeyAlloc(nkeys, 0);
+	BitSequence seed[SWIFFT_KEY_SEED_SIZE] = {0};
+	for (int l=0; l<nkeys; l++) {
+		seed[0] = (BitSequence)l;
+		SWIFFT_DeriveKey(seed, &keys[l]);
+	}
+	int nrepeats = nblocks*nkeys, nrounds = 50000;
+	test_swifft_iter_cycles(nrepeats, nrounds, 500, "multi-key-rounds", [&swifft, &input, &output, keys, nrounds]() {
+		for (int64_t i=0; i<nrounds; i++) {
+			swifft.hash.SWIFFT_ComputeMultipleMultiKey(nblocks, nkeys, keys, input.array[0].data, output.array[0].data);
+		}
+	});
+	SWIFFT_KeyFree(keys);
+}
+
+TEST_CASE( "swifft takes at most 2000 cycles per call with the best instruction-set", "[.][swifftperf]" ) {
+	srand(1);
+	SwifftInput input = {0};
+	SwifftInput sign = {0};
+	SWIFFT_ALIGN int16_t fftout[SWIFFT_N*SWIFFT_M];
+	SwifftOutput output = {0};
+	randomize(&input, 1);
+	int nrepeats = 1, nrounds=100000;
+	for_each_supported_iset([&](const swifft_object_t & swifft, swifft_iset_t iset) {
+		std::string name(SWIFFT_GetIsetName(iset));
+		// only the best instruction-set is limited, the others are measured for comparison
+		double limit = (iset == SWIFFT_GetBestIset()) ? 1.0 : std::numeric_limits<double>::max();
+		test_swifft_iter_cycles(nrepeats, nrounds, 2000 * limit, (name + "-rounds").c_str(), [&swifft, &input, &output, nrepeats, nrounds]() {
+			for (int r=0; r<nrepeats; r++) {
+				for (int64_t i=0; i<nrounds; i++) {
+					swifft.hash.SWIFFT_Compute(input.data, output.data);
+				}
+			}
+		});
+		test_swifft_iter_cycles(nrepeats, nrounds, 1500 * limit, (name + "-FFT-rounds").c_str(), [&swifft, &input, &sign, &fftout, nrepeats, nrounds]() {
+			for (int r=0; r<nrepeats; r++) {
+				for (int64_t i=0; i<nrounds; i++) {
+					swifft.fft.SWIFFT_fft(input.data, sign.data, SWIFFT_M, fftout);
+				}
+			}
+		});
+		test_swifft_iter_cycles(nrepeats, nrounds, 500 * limit, (name + "-FFT-sum-rounds").c_str(), [&swifft, &fftout, &output, nrepeats, nrounds]() {
+			for (int r=0; r<nrepeats; r++) {
+				for (int64_t i=0; i<nrounds; i++) {
+					swifft.fft.SWIFFT_fftsum(SWIFFT_PI_key, fftout, SWIFFT_M, (int16_t *)output.data);
+				}
+			}
+		});
+	});
+}
+
 TEST_CASE( "swifft speed is dependent on input size only", "[.][swifftperf]" ) {
 	swifft_object_t swifft;
 	SWIFFT_InitObject(&swifft);
@@ -256,6 +551,22 @@ TEST_CASE( "SWIFFT_modP after 0|1|2 SWIFFT_qReduce invocations is consistent", "
 	}
 }
 
+TEST_CASE( "SWIFFT_fftTable signed entries are centered differences of unsigned ones", "[swifft]" ) {
+	for (int w=0; w<SWIFFT_V; w++) {
+		for (int x=0; x<SWIFFT_V; x++) {
+			for (int j=0; j<SWIFFT_W; j++) {
+				int entry = SWIFFT_fftTable[(SWIFFT_INT16(w,x) << SWIFFT_LOG2_W) + j];
+				int diff = SWIFFT_fftTable[((x & ~w) << SWIFFT_LOG2_W) + j] - SWIFFT_fftTable[((x & w) << SWIFFT_LOG2_W) + j];
+				diff = (diff > 128) ? diff - SWIFFT_P : (diff < -128) ? diff + SWIFFT_P : diff;
+				CAPTURE( w );
+				CAPTURE( x );
+				CAPTURE( j );
+				REQUIRE( entry == diff );
+			}
+		}
+	}
+}
+
 TEST_CASE( "SWIFFT_fft is consistent across instruction-sets", "[swifft]" ) {
 	swifft_object_t swifft;
 	SWIFFT_InitObject(&swifft);
@@ -268,33 +579,82 @@ TEST_CASE( "SWIFFT_fft is consistent across instruction-sets", "[swifft]" ) {
 	SWIFFT_ALIGN int16_t fftout0[SWIFFT_N*SWIFFT_M] = {0};
 	swifft.fft.SWIFFT_fft(input.data, SWIFFT_sign0, SWIFFT_M, fftout0);
 	swifft.fft.SWIFFT_fftsum(SWIFFT_PI_key, fftout0, SWIFFT_M, (int16_t *)output0.data);
-#if defined(__AVX__)
-	swifft_object_t swifft_avx;
-	SWIFFT_InitObject(&swifft_avx);
-	SwifftOutput output1 = {0};
-	SWIFFT_ALIGN int16_t fftout1[SWIFFT_N*SWIFFT_M] = {0};
-	swifft_avx.fft.SWIFFT_fft(input.data, SWIFFT_sign0, SWIFFT_M, fftout1);
-	swifft_avx.fft.SWIFFT_fftsum(SWIFFT_PI_key, fftout1, SWIFFT_M, (int16_t *)output1.data);
-	CHECK( 0 == memcmp(fftout0, fftout1, sizeof(fftout1)) );
-#endif
-#if defined(__AVX2__)
-	swifft_object_t swifft_avx2;
-	SWIFFT_InitObject(&swifft_avx2);
-	SwifftOutput output2 = {0};
-	SWIFFT_ALIGN int16_t fftout2[SWIFFT_N*SWIFFT_M] = {0};
-	swifft_avx2.fft.SWIFFT_fft(input.data, SWIFFT_sign0, SWIFFT_M, fftout2);
-	swifft_avx2.fft.SWIFFT_fftsum(SWIFFT_PI_key, fftout2, SWIFFT_M, (int16_t *)output2.data);
-	CHECK( 0 == memcmp(fftout0, fftout2, sizeof(fftout1)) );
-#endif
-#if defined(__AVX512F__)
-	swifft_object_t swifft_avx512;
-	SWIFFT_InitObject(&swifft_avx512);
-	SwifftOutput output3 = {0};
-	SWIFFT_ALIGN int16_t fftout3[SWIFFT_N*SWIFFT_M] = {0};
-	swifft_avx512.fft.SWIFFT_fft(input.data, SWIFFT_sign0, SWIFFT_M, fftout3);
-	swifft_avx512.fft.SWIFFT_fftsum(SWIFFT_PI_key, fftout3, SWIFFT_M, (int16_t *)output3.data);
-	CHECK( 0 == memcmp(fftout0, fftout3, sizeof(fftout1)) );
-#endif
+	for_each_supported_iset([&](const swifft_object_t & swifft_iset, swifft_iset_t) {
+		SwifftOutput output1 = {0};
+		SWIFFT_ALIGN int16_t fftout1[SWIFFT_N*SWIFFT_M] = {0};
+		swifft_iset.fft.SWIFFT_fft(input.data, SWIFFT_sign0, SWIFFT_M, fftout1);
+		swifft_iset.fft.SWIFFT_fftsum(SWIFFT_PI_key, fftout1, SWIFFT_M, (int16_t *)output1.data);
+		CHECK( 0 == memcmp(fftout0, fftout1, sizeof(fftout1)) );
+		CHECK( output0 == output1 );
+		// a zero sign, other than SWIFFT_sign0, goes through the signed lookup
+		SwifftInput sign = {0};
+		SWIFFT_ALIGN int16_t fftout2[SWIFFT_N*SWIFFT_M] = {0};
+		swifft_iset.fft.SWIFFT_fft(input.data, sign.data, SWIFFT_M, fftout2);
+		CHECK( 0 == memcmp(fftout0, fftout2, sizeof(fftout2)) );
+	});
+}
+
+TEST_CASE( "SWIFFT_fft is consistent across numbers of 8-elements", "[swifft]" ) {
+	srand(1);
+	SwifftInput input = {0};
+	SwifftInput sign = {0};
+	randomize(&input, 1);
+	randomize(&sign, 1);
+	for_each_supported_iset([&](const swifft_object_t & swifft, swifft_iset_t) {
+		SWIFFT_ALIGN int16_t fftout0[SWIFFT_N*SWIFFT_M];
+		swifft.fft.SWIFFT_fft(input.data, sign.data, SWIFFT_M, fftout0);
+		// the FFT-output of a prefix of the input is a prefix of the FFT-output
+		for (int m=4; m<SWIFFT_M; m+=4) {
+			CAPTURE( m );
+			SWIFFT_ALIGN int16_t fftout1[SWIFFT_N*SWIFFT_M];
+			swifft.fft.SWIFFT_fft(input.data, sign.data, m, fftout1);
+			CHECK( 0 == memcmp(fftout0, fftout1, SWIFFT_N*m*sizeof(int16_t)) );
+		}
+	});
+}
+
+TEST_CASE( "swifft fused compute is consistent with FFT and FFT-sum", "[swifft]" ) {
+	srand(1);
+	SwifftInput input = {0};
+	SwifftInput sign = {0};
+	for (int j=0; j<SWIFFT_INPUT_BLOCK_SIZE; j++) {
+		input.data[j] = rand() & 0xFF;
+		sign.data[j] = rand() & 0xFF;
+	}
+	for_each_supported_iset([&](const swifft_object_t & swifft, swifft_iset_t) {
+		SwifftOutput output0, output1;
+		SWIFFT_ALIGN int16_t fftout[SWIFFT_N*SWIFFT_M];
+		swifft.fft.SWIFFT_fft(input.data, SWIFFT_sign0, SWIFFT_M, fftout);
+		swifft.fft.SWIFFT_fftsum(SWIFFT_PI_key, fftout, SWIFFT_M, (int16_t *)output0.data);
+		swifft.hash.SWIFFT_Compute(input.data, output1.data);
+		CHECK( output0 == output1 );
+		swifft.fft.SWIFFT_fft(input.data, sign.data, SWIFFT_M, fftout);
+		swifft.fft.SWIFFT_fftsum(SWIFFT_PI_key, fftout, SWIFFT_M, (int16_t *)output0.data);
+		swifft.hash.SWIFFT_ComputeSigned(input.data, sign.data, output1.data);
+		CHECK( output0 == output1 );
+	});
+}
+
+TEST_CASE( "SWIFFT_fftsum reduces sums of products mod 257 for any number of 8-elements", "[swifft]" ) {
+	srand(1);
+	SWIFFT_ALIGN int16_t fftout[SWIFFT_N*SWIFFT_M];
+	for (int j=0; j<SWIFFT_N*SWIFFT_M; j++) {
+		fftout[j] = (rand() % (3*128+127)) - 127;
+	}
+	for_each_supported_iset([&](const swifft_object_t & swifft, swifft_iset_t) {
+		for (int m=1; m<=SWIFFT_M; m++) {
+			CAPTURE( m );
+			SwifftOutput output;
+			swifft.fft.SWIFFT_fftsum(SWIFFT_PI_key, fftout, m, (int16_t *)output.data);
+			for (int e=0; e<SWIFFT_N; e++) {
+				int sum = 0;
+				for (int i=0; i<m; i++) {
+					sum += fftout[i*SWIFFT_N+e] * SWIFFT_PI_key[i*SWIFFT_N+e];
+				}
+				CHECK( ((int16_t *)output.data)[e] == ((sum % SWIFFT_P) + SWIFFT_P) % SWIFFT_P );
+			}
+		}
+	});
 }
 
 TEST_CASE( "SWIFFT_safeMult is correct on the range [-128+1,128-1]*[-128,128]", "[swifft]" ) {
@@ -991,15 +1351,10 @@ TEST_CASE( "swifft compacts correctly (specific input)", "[swifft]" ) {
 		} \
 	}
 	TESTCODE()
-#if defined(__AVX__)
-	TESTCODE(_AVX)
-#endif
-#if defined(__AVX2__)
-	TESTCODE(_AVX2)
-#endif
-#if defined(__AVX512F__)
-	TESTCODE(_AVX512)
-#endif
+	if (SWIFFT_IsIsetSupported(SWIFFT_ISET_AVX)) TESTCODE(_AVX)
+	if (SWIFFT_IsIsetSupported(SWIFFT_ISET_AVX2)) TESTCODE(_AVX2)
+	if (SWIFFT_IsIsetSupported(SWIFFT_ISET_AVX512)) TESTCODE(_AVX512)
+	if (SWIFFT_IsIsetSupported(SWIFFT_ISET_AVX512BW)) TESTCODE(_AVX512BW)
 #undef TESTCODE
 }
 
@@ -1019,18 +1374,99 @@ TEST_CASE( "swifft compacts signed correctly (specific input)", "[swifft]" ) {
 		} \
 	}
 	TESTCODE()
-#if defined(__AVX__)
-	TESTCODE(_AVX)
-#endif
-#if defined(__AVX2__)
-	TESTCODE(_AVX2)
-#endif
-#if defined(__AVX512F__)
-	TESTCODE(_AVX512)
-#endif
+	if (SWIFFT_IsIsetSupported(SWIFFT_ISET_AVX)) TESTCODE(_AVX)
+	if (SWIFFT_IsIsetSupported(SWIFFT_ISET_AVX2)) TESTCODE(_AVX2)
+	if (SWIFFT_IsIsetSupported(SWIFFT_ISET_AVX512)) TESTCODE(_AVX512)
+	if (SWIFFT_IsIsetSupported(SWIFFT_ISET_AVX512BW)) TESTCODE(_AVX512BW)
 #undef TESTCODE
 }
 
+TEST_CASE( "swifft compacts as base-257 to base-256 conversion", "[swifft]" ) {
+	const int nblocks = 11;
+	srand(1);
+	Array<SwifftOutput> output(nblocks);
+	Array<SwifftCompact> compact(nblocks);
+	for (int i=0; i<nblocks; i++) {
+		int16_t *digits = (int16_t *)output.array[i].data;
+		for (int j=0; j<SWIFFT_N; j++) {
+			// include the extreme digits 0 and 256 often
+			int r = rand() % 4;
+			digits[j] = (r == 0) ? 0 : (r == 1) ? SWIFFT_P-1 : rand() % SWIFFT_P;
+		}
+	}
+	for_each_supported_iset([&](const swifft_object_t & swifft, swifft_iset_t) {
+		swifft.hash.SWIFFT_CompactMultiple(nblocks, output.array[0].data, compact.array[0].data);
+		for (int i=0; i<nblocks; i++) {
+			CAPTURE( i );
+			const int16_t *digits = (const int16_t *)output.array[i].data;
+			SwifftCompact expected;
+			for (int j=0; j<SWIFFT_N/8; j++) {
+				// the number modulo 2^64, with its 8 base-257 digits most significant last
+				uint64_t value = 0;
+				for (int k=7; k>=0; k--) {
+					value = value * SWIFFT_P + digits[j*8+k];
+				}
+				for (int k=0; k<8; k++) {
+					expected.data[j*8+k] = (BitSequence)(value >> (8*k));
+				}
+			}
+			CHECK( compact.array[i] == expected );
+			SwifftCompact compact1;
+			swifft.hash.SWIFFT_Compact(output.array[i].data, compact1.data);
+			CHECK( compact1 == expected );
+		}
+	});
+}
+
+TEST_CASE( "swifft compacts losslessly with carry bits", "[swifft]" ) {
+	const int nblocks = 1000;
+	srand(1);
+	Array<SwifftOutput> output(nblocks);
+	// canonical elements, with the extremes 0 and 256 more frequent than others, and some blocks of only 0 or only 256
+	for (int i=0; i<nblocks; i++) {
+		int16_t *o = (int16_t *)output.array[i].data;
+		for (int j=0; j<SWIFFT_N; j++) {
+			int r = rand() % 4;
+			o[j] = r == 0 ? 0 : r == 1 ? SWIFFT_P-1 : rand() % SWIFFT_P;
+		}
+	}
+	SWIFFT_ConstSet(output.array[0].data, 0);
+	SWIFFT_ConstSet(output.array[1].data, SWIFFT_P-1);
+	for_each_supported_iset([&](const swifft_object_t & swifft, swifft_iset_t) {
+		Array<SwifftCompact> compact(nblocks);
+		Array<SwifftCompact> expected(nblocks);
+		Array<SwifftOutput> decompact(nblocks);
+		std::vector<BitSequence> carry(nblocks * SWIFFT_COMPACT_CARRY_SIZE);
+		swifft.hash.SWIFFT_CompactMultiple(nblocks, output.array[0].data, expected.array[0].data);
+		swifft.hash.SWIFFT_CompactWithCarryMultiple(nblocks, output.array[0].data, compact.array[0].data, carry.data());
+		swifft.hash.SWIFFT_DecompactMultiple(nblocks, compact.array[0].data, carry.data(), decompact.array[0].data);
+		CHECK( carry[0] == 0 );
+		CHECK( carry[1] == 0xff );
+		for (int i=0; i<nblocks; i++) {
+			CAPTURE( i );
+			CHECK( compact.array[i] == expected.array[i] );
+			CHECK( decompact.array[i] == output.array[i] );
+			// the carry bit of 8 elements is set if and only if their base-257 value is at least 2^64
+			const int16_t *o = (const int16_t *)output.array[i].data;
+			for (int g=0; g<SWIFFT_N/8; g++) {
+				__extension__ unsigned __int128 value = 0;
+				for (int j=7; j>=0; j--) {
+					value = value * SWIFFT_P + o[8*g+j];
+				}
+				CHECK( ((carry[i] >> g) & 1) == (value >> 64) );
+			}
+			SwifftCompact single;
+			BitSequence singleCarry[SWIFFT_COMPACT_CARRY_SIZE];
+			SwifftOutput singleOutput;
+			swifft.hash.SWIFFT_CompactWithCarry(output.array[i].data, single.data, singleCarry);
+			CHECK( single == expected.array[i] );
+			CHECK( singleCarry[0] == carry[i] );
+			swifft.hash.SWIFFT_Decompact(single.data, singleCarry, singleOutput.data);
+			CHECK( singleOutput == output.array[i] );
+		}
+	});
+}
+
 TEST_CASE( "swifft computes multiple correctly (specific input)", "[swifft]" ) {
 #define TESTCODE(suffix) \
 	{ \
@@ -1044,15 +1480,10 @@ TEST_CASE( "swifft computes multiple correctly (specific input)", "[swifft]" ) {
 		} \
 	}
 	TESTCODE()
-#if defined(__AVX__)
-	TESTCODE(_AVX)
-#endif
-#if defined(__AVX2__)
-	TESTCODE(_AVX2)
-#endif
-#if defined(__AVX512F__)
-	TESTCODE(_AVX512)
-#endif
+	if (SWIFFT_IsIsetSupported(SWIFFT_ISET_AVX)) TESTCODE(_AVX)
+	if (SWIFFT_IsIsetSupported(SWIFFT_ISET_AVX2)) TESTCODE(_AVX2)
+	if (SWIFFT_IsIsetSupported(SWIFFT_ISET_AVX512)) TESTCODE(_AVX512)
+	if (SWIFFT_IsIsetSupported(SWIFFT_ISET_AVX512BW)) TESTCODE(_AVX512BW)
 #undef TESTCODE
 }
 
@@ -1070,18 +1501,503 @@ TEST_CASE( "swifft computes multiple signed correctly (specific input)", "[swiff
 		} \
 	}
 	TESTCODE()
-#if defined(__AVX__)
-	TESTCODE(_AVX)
-#endif
-#if defined(__AVX2__)
-	TESTCODE(_AVX2)
-#endif
-#if defined(__AVX512F__)
-	TESTCODE(_AVX512)
-#endif
+	if (SWIFFT_IsIsetSupported(SWIFFT_ISET_AVX)) TESTCODE(_AVX)
+	if (SWIFFT_IsIsetSupported(SWIFFT_ISET_AVX2)) TESTCODE(_AVX2)
+	if (SWIFFT_IsIsetSupported(SWIFFT_ISET_AVX512)) TESTCODE(_AVX512)
+	if (SWIFFT_IsIsetSupported(SWIFFT_ISET_AVX512BW)) TESTCODE(_AVX512BW)
 #undef TESTCODE
 }
 
+TEST_CASE( "swifft computes multiple consistently with single blocks", "[swifft]" ) {
+	const int nblocks = 11; // not a multiple of the number of interleaved blocks
+	srand(1);
+	Array<SwifftInput> input(nblocks);
+	Array<SwifftInput> sign(nblocks);
+	Array<SwifftOutput> output(nblocks);
+	randomize(input.array, nblocks);
+	randomize(sign.array, nblocks);
+	for_each_supported_iset([&](const swifft_object_t & swifft, swifft_iset_t) {
+		SwifftOutput output1;
+		swifft.hash.SWIFFT_ComputeMultiple(nblocks, input.array[0].data, output.array[0].data);
+		for (int i=0; i<nblocks; i++) {
+			CAPTURE( i );
+			swifft.hash.SWIFFT_Compute(input.array[i].data, output1.data);
+			CHECK( output.array[i] == output1 );
+		}
+		swifft.hash.SWIFFT_ComputeMultipleSigned(nblocks, input.array[0].data, sign.array[0].data, output.array[0].data);
+		for (int i=0; i<nblocks; i++) {
+			CAPTURE( i );
+			swifft.hash.SWIFFT_ComputeSigned(input.array[i].data, sign.array[i].data, output1.data);
+			CHECK( output.array[i] == output1 );
+		}
+	});
+}
+
+TEST_CASE( "swifft computes sums of multiple blocks consistently with summing single blocks", "[swifft]" ) {
+	const int nmax = 2*256 + 3; // more than one chunk, and enough for a reduction of the FFT sums
+	srand(1);
+	Array<SwifftInput> input(nmax);
+	Array<SwifftInput> sign(nmax);
+	Array<SwifftOutput> output(nmax);
+	std::vector<int16_t> coeffs(nmax);
+	randomize(input.array, nmax);
+	randomize(sign.array, nmax);
+	for (int i=0; i<nmax; i++) {
+		coeffs[i] = (i < 4) ? ((i & 1) ? INT16_MIN : 128) : (int16_t)rand();
+	}
+	for (int i=0; i<4; i++) {
+		// inputs of all-ones bits first
+		memset(input.array[i].data, 0xff, SWIFFT_INPUT_BLOCK_SIZE);
+		memset(sign.array[i].data, (i & 1) ? 0xff : 0, SWIFFT_INPUT_BLOCK_SIZE);
+	}
+	// a random key, for the sums with a given key
+	std::vector<int16_t> values(SWIFFT_KEY_SIZE);
+	for (int j=0; j<SWIFFT_KEY_SIZE; j++) {
+		values[j] = (int16_t)rand();
+	}
+	swifft_key_t *key = SWIFFT_KeyAlloc(1, 0);
+	REQUIRE( key != NULL );
+	SWIFFT_KeyInit(key, values.data());
+	for_each_supported_iset([&](const swifft_object_t & swifft, swifft_iset_t) {
+		for (int n : {0, 1, 2, 65, 256, nmax}) {
+			CAPTURE( n );
+			SwifftOutput expected, result;
+			swifft.hash.SWIFFT_ComputeMultiple(n, input.array[0].data, output.array[0].data);
+			swifft.arith.SWIFFT_SumMultiple(n, output.array[0].data, expected.data);
+			swifft.hash.SWIFFT_ComputeSum(n, input.array[0].data, result.data);
+			CHECK( result == expected );
+			swifft.arith.SWIFFT_LinearCombination(n, coeffs.data(), output.array[0].data, expected.data);
+			swifft.hash.SWIFFT_ComputeLinearCombination(n, coeffs.data(), input.array[0].data, result.data);
+			CHECK( result == expected );
+			swifft.hash.SWIFFT_ComputeMultipleSigned(n, input.array[0].data, sign.array[0].data, output.array[0].data);
+			swifft.arith.SWIFFT_SumMultiple(n, output.array[0].data, expected.data);
+			swifft.hash.SWIFFT_ComputeSumSigned(n, input.array[0].data, sign.array[0].data, result.data);
+			CHECK( result == expected );
+			swifft.arith.SWIFFT_LinearCombination(n, coeffs.data(), output.array[0].data, expected.data);
+			swifft.hash.SWIFFT_ComputeLinearCombinationSigned(n, coeffs.data(), input.array[0].data, sign.array[0].data, result.data);
+			CHECK( result == expected );
+			swifft.hash.SWIFFT_ComputeMultipleKeyed(n, key, input.array[0].data, output.array[0].data);
+			swifft.arith.SWIFFT_SumMultiple(n, output.array[0].data, expected.data);
+			swifft.hash.SWIFFT_ComputeSumKeyed(n, key, input.array[0].data, result.data);
+			CHECK( result == expected );
+			swifft.arith.SWIFFT_LinearCombination(n, coeffs.data(), output.array[0].data, expected.data);
+			swifft.hash.SWIFFT_ComputeLinearCombinationKeyed(n, key, coeffs.data(), input.array[0].data, result.data);
+			CHECK( result == expected );
+			swifft.hash.SWIFFT_ComputeMultipleSignedKeyed(n, key, input.array[0].data, sign.array[0].data, output.array[0].data);
+			swifft.arith.SWIFFT_SumMultiple(n, output.array[0].data, expected.data);
+			swifft.hash.SWIFFT_ComputeSumSignedKeyed(n, key, input.array[0].data, sign.array[0].data, result.data);
+			CHECK( result == expected );
+			swifft.arith.SWIFFT_LinearCombination(n, coeffs.data(), output.array[0].data, expected.data);
+			swifft.hash.SWIFFT_ComputeLinearCombinationSignedKeyed(n, key, coeffs.data(), input.array[0].data, sign.array[0].data, result.data);
+			CHECK( result == expected );
+		}
+	});
+	SWIFFT_KeyFree(key);
+}
+
+TEST_CASE( "swifft computes with a given key consistently with the built-in key", "[swifft]" ) {
+	const int nblocks = 29;
+	srand(1);
+	Array<SwifftInput> input(nblocks);
+	Array<SwifftInput> sign(nblocks);
+	randomize(input.array, nblocks);
+	randomize(sign.array, nblocks);
+	// the built-in key, not centered and offset by multiples of 257, is prepared as the built-in key
+	std::vector<int16_t> values(SWIFFT_KEY_SIZE);
+	for (int j=0; j<SWIFFT_KEY_SIZE; j++) {
+		values[j] = (SWIFFT_PI_key[j] + SWIFFT_P) % SWIFFT_P + SWIFFT_P * (rand() % 200 - 100);
+	}
+	swifft_key_t *keys = SWIFFT_KeyAlloc(3, 1);
+	REQUIRE( keys != NULL );
+	// aligned to a huge page of 2MB, as requested
+	CHECK( ((uintptr_t)keys & ((2 << 20) - 1)) == 0 );
+	SWIFFT_KeyInit(&keys[0], values.data());
+	CHECK( memcmp(keys[0].layouts, SWIFFT_PI_keyO, sizeof(keys[0].layouts)) == 0 );
+	// a random key, and keys with ones for the 64 input bits of index 0 or 1, and zeros elsewhere
+	for (int j=0; j<SWIFFT_KEY_SIZE; j++) {
+		values[j] = (int16_t)rand();
+	}
+	SWIFFT_KeyInit(&keys[1], values.data());
+	Array<SwifftOutput> expected(nblocks);
+	Array<SwifftOutput> expectedSigned(nblocks);
+	for (int i=0; i<SWIFFT_M; i++) {
+		// the key with ones at the i-th 64 input bits gives the FFT of these bits, which the random key multiplies
+		std::vector<int16_t> unit(SWIFFT_KEY_SIZE, 0);
+		for (int q=0; q<SWIFFT_N; q++) {
+			unit[i*SWIFFT_N + q] = 1;
+		}
+		SWIFFT_KeyInit(&keys[2], unit.data());
+		Array<SwifftOutput> fftout(nblocks);
+		Array<SwifftOutput> fftoutSigned(nblocks);
+		SWIFFT_ComputeMultipleKeyed(nblocks, &keys[2], input.array[0].data, fftout.array[0].data);
+		SWIFFT_ComputeMultipleSignedKeyed(nblocks, &keys[2], input.array[0].data, sign.array[0].data, fftoutSigned.array[0].data);
+		for (int b=0; b<nblocks; b++) {
+			int16_t *e = (int16_t *)expected.array[b].data, *es = (int16_t *)expectedSigned.array[b].data;
+			const int16_t *f = (const int16_t *)fftout.array[b].data, *fs = (const int16_t *)fftoutSigned.array[b].data;
+			for (int q=0; q<SWIFFT_N; q++) {
+				int k = values[i*SWIFFT_N + q] % SWIFFT_P;
+				e[q] = (int16_t)(((i == 0 ? 0 : e[q]) + k * f[q] % SWIFFT_P + SWIFFT_P) % SWIFFT_P);
+				es[q] = (int16_t)(((i == 0 ? 0 : es[q]) + k * fs[q] % SWIFFT_P + SWIFFT_P) % SWIFFT_P);
+			}
+		}
+	}
+	for_each_supported_iset([&](const swifft_object_t & swifft, swifft_iset_t) {
+		Array<SwifftOutput> builtin(nblocks);
+		Array<SwifftOutput> keyed(nblocks);
+		swifft.hash.SWIFFT_ComputeMultiple(nblocks, input.array[0].data, builtin.array[0].data);
+		swifft.hash.SWIFFT_ComputeMultipleKeyed(nblocks, &keys[0], input.array[0].data, keyed.array[0].data);
+		for (int b=0; b<nblocks; b++) {
+			CAPTURE( b );
+			CHECK( keyed.array[b] == builtin.array[b] );
+		}
+		swifft.hash.SWIFFT_ComputeMultipleSigned(nblocks, input.array[0].data, sign.array[0].data, builtin.array[0].data);
+		swifft.hash.SWIFFT_ComputeMultipleSignedKeyed(nblocks, &keys[0], input.array[0].data, sign.array[0].data, keyed.array[0].data);
+		for (int b=0; b<nblocks; b++) {
+			CAPTURE( b );
+			CHECK( keyed.array[b] == builtin.array[b] );
+		}
+		swifft.hash.SWIFFT_ComputeMultipleKeyed(nblocks, &keys[1], input.array[0].data, keyed.array[0].data);
+		for (int b=0; b<nblocks; b++) {
+			CAPTURE( b );
+			CHECK( keyed.array[b] == expected.array[b] );
+			SwifftOutput single;
+			swifft.hash.SWIFFT_ComputeKeyed(&keys[1], input.array[b].data, single.data);
+			CHECK( single == expected.array[b] );
+		}
+		swifft.hash.SWIFFT_ComputeMultipleSignedKeyed(nblocks, &keys[1], input.array[0].data, sign.array[0].data, keyed.array[0].data);
+		for (int b=0; b<nblocks; b++) {
+			CAPTURE( b );
+			CHECK( keyed.array[b] == expectedSigned.array[b] );
+			SwifftOutput single;
+			swifft.hash.SWIFFT_ComputeSignedKeyed(&keys[1], input.array[b].data, sign.array[b].data, single.data);
+			CHECK( single == expectedSigned.array[b] );
+		}
+		// short input is hashed with a given key as if padded with zeros to 256 bytes
+		for (int size=SWIFFT_INPUT_BLOCK_SIZE_128; size>=SWIFFT_INPUT_BLOCK_SIZE_64; size/=2) {
+			CAPTURE( size );
+			Array<SwifftInput> padded(nblocks);
+			Array<SwifftInput> paddedSign(nblocks);
+			std::vector<BitSequence> shortInput((size_t)nblocks*size), shortSign((size_t)nblocks*size);
+			memset(padded.array[0].data, 0, nblocks*sizeof(SwifftInput));
+			memset(paddedSign.array[0].data, 0, nblocks*sizeof(SwifftInput));
+			for (int b=0; b<nblocks; b++) {
+				memcpy(padded.array[b].data, input.array[b].data, size);
+				memcpy(paddedSign.array[b].data, sign.array[b].data, size);
+				memcpy(&shortInput[(size_t)b*size], input.array[b].data, size);
+				memcpy(&shortSign[(size_t)b*size], sign.array[b].data, size);
+			}
+			Array<SwifftOutput> expectedShort(nblocks);
+			Array<SwifftOutput> expectedShortSigned(nblocks);
+			swifft.hash.SWIFFT_ComputeMultipleKeyed(nblocks, &keys[1], padded.array[0].data, expectedShort.array[0].data);
+			swifft.hash.SWIFFT_ComputeMultipleSignedKeyed(nblocks, &keys[1], padded.array[0].data, paddedSign.array[0].data, expectedShortSigned.array[0].data);
+			Array<SwifftOutput> shortKeyed(nblocks);
+			Array<SwifftOutput> shortKeyedSigned(nblocks);
+			if (size == SWIFFT_INPUT_BLOCK_SIZE_128) {
+				swifft.hash.SWIFFT_ComputeMultiple128Keyed(nblocks, &keys[1], shortInput.data(), shortKeyed.array[0].data);
+				swifft.hash.SWIFFT_ComputeMultipleSigned128Keyed(nblocks, &keys[1], shortInput.data(), shortSign.data(), shortKeyedSigned.array[0].data);
+			} else {
+				swifft.hash.SWIFFT_ComputeMultiple64Keyed(nblocks, &keys[1], shortInput.data(), shortKeyed.array[0].data);
+				swifft.hash.SWIFFT_ComputeMultipleSigned64Keyed(nblocks, &keys[1], shortInput.data(), shortSign.data(), shortKeyedSigned.array[0].data);
+			}
+			for (int b=0; b<nblocks; b++) {
+				CAPTURE( b );
+				CHECK( shortKeyed.array[b] == expectedShort.array[b] );
+				CHECK( shortKeyedSigned.array[b] == expectedShortSigned.array[b] );
+				SwifftOutput single, singleSigned;
+				if (size == SWIFFT_INPUT_BLOCK_SIZE_128) {
+					swifft.hash.SWIFFT_Compute128Keyed(&keys[1], &shortInput[(size_t)b*size], single.data);
+					swifft.hash.SWIFFT_ComputeSigned128Keyed(&keys[1], &shortInput[(size_t)b*size], &shortSign[(size_t)b*size], singleSigned.data);
+				} else {
+					swifft.hash.SWIFFT_Compute64Keyed(&keys[1], &shortInput[(size_t)b*size], single.data);
+					swifft.hash.SWIFFT_ComputeSigned64Keyed(&keys[1], &shortInput[(size_t)b*size], &shortSign[(size_t)b*size], singleSigned.data);
+				}
+				CHECK( single == expectedShort.array[b] );
+				CHECK( singleSigned == expectedShortSigned.array[b] );
+			}
+		}
+	});
+	SWIFFT_KeyFree(keys);
+}
+
+TEST_CASE( "swifft computes with multiple keys consistently with each key", "[swifft]" ) {
+	const int nblocks = 29, nkeys = 3;
+	srand(1);
+	Array<SwifftInput> input(nblocks);
+	Array<SwifftInput> sign(nblocks);
+	randomize(input.array, nblocks);
+	randomize(sign.array, nblocks);
+	swifft_key_t *keys = SWIFFT_KeyAlloc(nkeys, 0);
+	REQUIRE( keys != NULL );
+	BitSequence seed[SWIFFT_KEY_SEED_SIZE] = {0};
+	for (int l=0; l<nkeys; l++) {
+		seed[0] = (BitSequence)l;
+		SWIFFT_DeriveKey(seed, &keys[l]);
+	}
+	for_each_supported_iset([&](const swifft_object_t & swifft, swifft_iset_t) {
+		for (int s=0; s<2; s++) {
+			CAPTURE( s );
+			Array<SwifftOutput> multi(nblocks*nkeys);
+			if (s) {
+				swifft.hash.SWIFFT_ComputeMultipleSignedMultiKey(nblocks, nkeys, keys, input.array[0].data, sign.array[0].data, multi.array[0].data);
+			} else {
+				swifft.hash.SWIFFT_ComputeMultipleMultiKey(nblocks, nkeys, keys, input.array[0].data, multi.array[0].data);
+			}
+			for (int l=0; l<nkeys; l++) {
+				CAPTURE( l );
+				Array<SwifftOutput> keyed(nblocks);
+				if (s) {
+					swifft.hash.SWIFFT_ComputeMultipleSignedKeyed(nblocks, &keys[l], input.array[0].data, sign.array[0].data, keyed.array[0].data);
+				} else {
+					swifft.hash.SWIFFT_ComputeMultipleKeyed(nblocks, &keys[l], input.array[0].data, keyed.array[0].data);
+				}
+				for (int b=0; b<nblocks; b++) {
+					CAPTURE( b );
+					CHECK( multi.array[b*nkeys+l] == keyed.array[b] );
+				}
+			}
+			for (int b=0; b<nblocks; b++) {
+				CAPTURE( b );
+				Array<SwifftOutput> single(nkeys);
+				if (s) {
+					swifft.hash.SWIFFT_ComputeSignedMultiKey(nkeys, keys, input.array[b].data, sign.array[b].data, single.array[0].data);
+				} else {
+					swifft.hash.SWIFFT_ComputeMultiKey(nkeys, keys, input.array[b].data, single.array[0].data);
+				}
+				for (int l=0; l<nkeys; l++) {
+					CHECK( single.array[l] == multi.array[b*nkeys+l] );
+				}
+			}
+		}
+	});
+	SWIFFT_KeyFree(keys);
+}
+
+TEST_CASE( "swifft derives keys from a seed reproducibly and uniformly", "[swifft]" ) {
+	// checksums h = 31*h + (uint16_t)element over the elements of the keys derived from test seeds
+	// with a reference implementation, the last seed having a rejected word in its keystream
+	BitSequence seeds[3][SWIFFT_KEY_SEED_SIZE] = {{0}, {0}, {35}};
+	for (int j=0; j<SWIFFT_KEY_SEED_SIZE; j++) {
+		seeds[1][j] = (BitSequence)j;
+	}
+	const uint32_t checksums[3] = {0xde5b55d8, 0x6757be4a, 0x481eabf2};
+	const int16_t heads[3][4] = {{-66, 51, -81, -83}, {61, -82, 20, -81}, {88, -14, 84, 19}};
+	const int nseeds = 64;
+	swifft_key_t *keys = SWIFFT_KeyAlloc(2, 0);
+	REQUIRE( keys != NULL );
+	for_each_supported_iset([&](const swifft_object_t & swifft, swifft_iset_t) {
+		for (int s=0; s<3; s++) {
+			CAPTURE( s );
+			swifft.hash.SWIFFT_DeriveKey(seeds[s], &keys[0]);
+			// the layout for SWIFFT vectors is in the order of the elements
+			uint32_t checksum = 0;
+			for (int j=0; j<SWIFFT_KEY_SIZE; j++) {
+				checksum = 31*checksum + (uint16_t)keys[0].layouts[j];
+			}
+			CHECK( checksum == checksums[s] );
+			CHECK( memcmp(keys[0].layouts, heads[s], sizeof(heads[s])) == 0 );
+			SWIFFT_KeyInit(&keys[1], keys[0].layouts);
+			CHECK( memcmp(&keys[0], &keys[1], sizeof(swifft_key_t)) == 0 );
+		}
+		// each element is about equally frequent, within about 6 standard deviations
+		std::vector<int> counts(SWIFFT_P, 0);
+		BitSequence seed[SWIFFT_KEY_SEED_SIZE] = {0};
+		for (int s=0; s<nseeds; s++) {
+			seed[SWIFFT_KEY_SEED_SIZE-1] = (BitSequence)s;
+			swifft.hash.SWIFFT_DeriveKey(seed, &keys[0]);
+			for (int j=0; j<SWIFFT_KEY_SIZE; j++) {
+				counts[keys[0].layouts[j] + SWIFFT_P/2]++;
+			}
+		}
+		for (int v=0; v<SWIFFT_P; v++) {
+			CAPTURE( v );
+			CHECK( std::abs(counts[v] - nseeds*SWIFFT_KEY_SIZE/SWIFFT_P) < 150 );
+		}
+	});
+	SWIFFT_KeyFree(keys);
+}
+
+TEST_CASE( "swifft bit updates are consistent with computing the new input", "[swifft]" ) {
+	const int nblocks = 29, nbits = 8*SWIFFT_INPUT_BLOCK_SIZE;
+	srand(1);
+	Array<SwifftInput> oldInput(nblocks);
+	Array<SwifftInput> oldSign(nblocks);
+	randomize(oldInput.array, nblocks);
+	randomize(oldSign.array, nblocks);
+	std::vector<int> positions(nbits);
+	for (int i=0; i<nbits; i++) {
+		int j = rand() % (i + 1);
+		positions[i] = positions[j];
+		positions[j] = i;
+	}
+	for_each_supported_iset([&](const swifft_object_t & swifft, swifft_iset_t) {
+		for (int npositions : {0, 1, 5, 100, nbits}) {
+			CAPTURE( npositions );
+			// the new input and sign bits are random at the positions, so some do not change
+			Array<SwifftInput> newInput(nblocks);
+			Array<SwifftInput> newSign(nblocks);
+			for (int i=0; i<nblocks; i++) {
+				newInput.array[i] = oldInput.array[i];
+				newSign.array[i] = oldSign.array[i];
+				for (int j=0; j<npositions; j++) {
+					int p = positions[j];
+					newInput.array[i].data[p >> 3] ^= (rand() & 1) << (p & 7);
+					newSign.array[i].data[p >> 3] ^= (rand() & 1) << (p & 7);
+				}
+			}
+			Array<SwifftOutput> output(nblocks);
+			Array<SwifftOutput> expected(nblocks);
+			swifft.hash.SWIFFT_ComputeMultiple(nblocks, oldInput.array[0].data, output.array[0].data);
+			swifft.hash.SWIFFT_ComputeMultiple(nblocks, newInput.array[0].data, expected.array[0].data);
+			swifft.hash.SWIFFT_UpdateBits(output.array[0].data, npositions, positions.data(),
+				oldInput.array[0].data, newInput.array[0].data);
+			swifft.hash.SWIFFT_UpdateBitsMultiple(nblocks-1, output.array[1].data, npositions, positions.data(),
+				oldInput.array[1].data, newInput.array[1].data);
+			for (int i=0; i<nblocks; i++) {
+				CAPTURE( i );
+				CHECK( output.array[i] == expected.array[i] );
+			}
+			swifft.hash.SWIFFT_ComputeMultipleSigned(nblocks, oldInput.array[0].data, oldSign.array[0].data, output.array[0].data);
+			swifft.hash.SWIFFT_ComputeMultipleSigned(nblocks, newInput.array[0].data, newSign.array[0].data, expected.array[0].data);
+			swifft.hash.SWIFFT_UpdateBitsSigned(output.array[0].data, npositions, positions.data(),
+				oldInput.array[0].data, oldSign.array[0].data, newInput.array[0].data, newSign.array[0].data);
+			swifft.hash.SWIFFT_UpdateBitsMultipleSigned(nblocks-1, output.array[1].data, npositions, positions.data(),
+				oldInput.array[1].data, oldSign.array[1].data, newInput.array[1].data, newSign.array[1].data);
+			for (int i=0; i<nblocks; i++) {
+				CAPTURE( i );
+				CHECK( output.array[i] == expected.array[i] );
+			}
+		}
+	});
+}
+
+TEST_CASE( "swifft sparse input is consistent with dense input", "[swifft]" ) {
+	const int nblocks = 29, nbits = 8*SWIFFT_INPUT_BLOCK_SIZE;
+	// numbers of nonzero bits below and above the threshold for the dense computation, of any instruction-set
+	const int counts[nblocks] = {0, 1, 2, 64, 65, 200, 300, 700, 1000, nbits};
+	srand(1);
+	std::vector<int> offsets(nblocks + 1);
+	std::vector<int> indices;
+	std::vector<BitSequence> signs;
+	Array<SwifftInput> input(nblocks);
+	Array<SwifftInput> sign(nblocks);
+	for (int i=0; i<nblocks; i++) {
+		int count = (i < 10) ? counts[i] : rand() % 100;
+		std::vector<int> positions(nbits);
+		for (int j=0; j<nbits; j++) {
+			int k = rand() % (j + 1);
+			positions[j] = positions[k];
+			positions[k] = j;
+		}
+		input.array[i] = 0;
+		sign.array[i] = 0;
+		offsets[i] = indices.size();
+		for (int j=0; j<count; j++) {
+			int p = positions[j];
+			BitSequence s = rand() & 1;
+			indices.push_back(p);
+			signs.push_back(s);
+			input.array[i].data[p >> 3] |= 1 << (p & 7);
+			sign.array[i].data[p >> 3] |= s << (p & 7);
+		}
+	}
+	offsets[nblocks] = indices.size();
+	for_each_supported_iset([&](const swifft_object_t & swifft, swifft_iset_t) {
+		Array<SwifftOutput> expected(nblocks);
+		Array<SwifftOutput> output(nblocks);
+		swifft.hash.SWIFFT_ComputeMultiple(nblocks, input.array[0].data, expected.array[0].data);
+		swifft.hash.SWIFFT_ComputeSparseMultiple(nblocks, offsets.data(), indices.data(), output.array[0].data);
+		for (int i=0; i<nblocks; i++) {
+			CAPTURE( i, offsets[i+1] - offsets[i] );
+			CHECK( output.array[i] == expected.array[i] );
+			SwifftOutput result;
+			swifft.hash.SWIFFT_ComputeSparse(offsets[i+1] - offsets[i], indices.data() + offsets[i], result.data);
+			CHECK( result == expected.array[i] );
+		}
+		swifft.hash.SWIFFT_ComputeMultipleSigned(nblocks, input.array[0].data, sign.array[0].data, expected.array[0].data);
+		swifft.hash.SWIFFT_ComputeSparseMultipleSigned(nblocks, offsets.data(), indices.data(), signs.data(), output.array[0].data);
+		for (int i=0; i<nblocks; i++) {
+			CAPTURE( i, offsets[i+1] - offsets[i] );
+			CHECK( output.array[i] == expected.array[i] );
+			SwifftOutput result;
+			swifft.hash.SWIFFT_ComputeSparseSigned(offsets[i+1] - offsets[i], indices.data() + offsets[i],
+				signs.data() + offsets[i], result.data);
+			CHECK( result == expected.array[i] );
+		}
+	});
+}
+
+TEST_CASE( "swifft on short input is consistent with zero-padded input", "[swifft]" ) {
+	const int nblocks = 11;
+	srand(1);
+	Array<SwifftInput> input(nblocks);
+	Array<SwifftInput> sign(nblocks);
+	randomize(input.array, nblocks);
+	randomize(sign.array, nblocks);
+	for_each_supported_iset([&](const swifft_object_t & swifft, swifft_iset_t) {
+		for (size_t size : {SWIFFT_INPUT_BLOCK_SIZE_128, SWIFFT_INPUT_BLOCK_SIZE_64}) {
+			CAPTURE( size );
+			// the short inputs are packed contiguously, while the padded ones are zero-padded blocks
+			Array<SwifftInput> padded(nblocks);
+			Array<SwifftInput> paddedSign(nblocks);
+			Array<SwifftInput> packed(nblocks);
+			Array<SwifftInput> packedSign(nblocks);
+			Array<SwifftOutput> output0(nblocks);
+			Array<SwifftOutput> output1(nblocks);
+			for (int i=0; i<nblocks; i++) {
+				padded.array[i] = 0;
+				paddedSign.array[i] = 0;
+				memcpy(padded.array[i].data, input.array[i].data, size);
+				memcpy(paddedSign.array[i].data, sign.array[i].data, size);
+				memcpy(packed.array[0].data + i*size, input.array[i].data, size);
+				memcpy(packedSign.array[0].data + i*size, sign.array[i].data, size);
+			}
+			bool is128 = (size == SWIFFT_INPUT_BLOCK_SIZE_128);
+			swifft.hash.SWIFFT_ComputeMultiple(nblocks, padded.array[0].data, output0.array[0].data);
+			(is128 ? swifft.hash.SWIFFT_ComputeMultiple128 : swifft.hash.SWIFFT_ComputeMultiple64)(nblocks, packed.array[0].data, output1.array[0].data);
+			for (int i=0; i<nblocks; i++) {
+				CAPTURE( i );
+				CHECK( output0.array[i] == output1.array[i] );
+				SwifftOutput output;
+				(is128 ? swifft.hash.SWIFFT_Compute128 : swifft.hash.SWIFFT_Compute64)(input.array[i].data, output.data);
+				CHECK( output0.array[i] == output );
+			}
+			swifft.hash.SWIFFT_ComputeMultipleSigned(nblocks, padded.array[0].data, paddedSign.array[0].data, output0.array[0].data);
+			(is128 ? swifft.hash.SWIFFT_ComputeMultipleSigned128 : swifft.hash.SWIFFT_ComputeMultipleSigned64)(nblocks, packed.array[0].data, packedSign.array[0].data, output1.array[0].data);
+			for (int i=0; i<nblocks; i++) {
+				CAPTURE( i );
+				CHECK( output0.array[i] == output1.array[i] );
+				SwifftOutput output;
+				(is128 ? swifft.hash.SWIFFT_ComputeSigned128 : swifft.hash.SWIFFT_ComputeSigned64)(input.array[i].data, sign.array[i].data, output.data);
+				CHECK( output0.array[i] == output );
+			}
+		}
+	});
+}
+
+TEST_CASE( "swifft selects instruction-set at runtime", "[swifft]" ) {
+	swifft_iset_t iset0 = SWIFFT_GetIset();
+	REQUIRE( iset0 == SWIFFT_GetBestIset() );
+	REQUIRE( SWIFFT_IsIsetSupported(iset0) );
+	REQUIRE( -1 == SWIFFT_SetIset(SWIFFT_ISET_NONE) );
+	REQUIRE( iset0 == SWIFFT_GetIset() );
+	for (int iset=SWIFFT_ISET_AVX; iset<=SWIFFT_ISET_AVX512BW; iset++) {
+		CAPTURE( SWIFFT_GetIsetName((swifft_iset_t)iset) );
+		if (!SWIFFT_IsIsetSupported((swifft_iset_t)iset)) {
+			REQUIRE( -1 == SWIFFT_SetIset((swifft_iset_t)iset) );
+			continue;
+		}
+		REQUIRE( 0 == SWIFFT_SetIset((swifft_iset_t)iset) );
+		REQUIRE( iset == SWIFFT_GetIset() );
+		SwifftOutput output;
+		for (int i=0; i<ninputs; i++) {
+			CAPTURE( i );
+			SWIFFT_Compute(specific_input1[i].data, output.data);
+			REQUIRE( output == specific_output1[i] );
+		}
+	}
+	REQUIRE( 0 == SWIFFT_SetIset(iset0) );
+}
+
 TEST_CASE( "swifft vector-and-const operations compute correctly", "[swifft]" ) {
 #define TESTCODE(suffix) \
 	{ \
@@ -1105,18 +2021,61 @@ TEST_CASE( "swifft vector-and-const operations compute correctly", "[swifft]" )
 		REQUIRE( output1 == output2 ); \
 	}
 	TESTCODE()
-#if defined(__AVX__)
-	TESTCODE(_AVX)
-#endif
-#if defined(__AVX2__)
-	TESTCODE(_AVX2)
-#endif
-#if defined(__AVX512F__)
-	TESTCODE(_AVX512)
-#endif
+	if (SWIFFT_IsIsetSupported(SWIFFT_ISET_AVX)) TESTCODE(_AVX)
+	if (SWIFFT_IsIsetSupported(SWIFFT_ISET_AVX2)) TESTCODE(_AVX2)
+	if (SWIFFT_IsIsetSupported(SWIFFT_ISET_AVX512)) TESTCODE(_AVX512)
+	if (SWIFFT_IsIsetSupported(SWIFFT_ISET_AVX512BW)) TESTCODE(_AVX512BW)
 #undef TESTCODE
 }
 
+TEST_CASE( "swifft multiplication does not overflow for elements near 257", "[swifft]" ) {
+	// products of elements in {0,..,256}, such as 200*200, overflow 16 bits unless centered first
+	const int16_t elements[] = {0, 1, 2, 127, 128, 129, 200, 255, 256};
+	const int nelements = sizeof(elements)/sizeof(elements[0]);
+	// multipliers out of {0,..,256} are taken mod 257
+	const int16_t multipliers[] = {200, 256, -1, -200, 257, 300, 514+200, -300, 32767, -32768};
+	const int nmultipliers = sizeof(multipliers)/sizeof(multipliers[0]);
+	const int nblocks = 2;
+	Array<SwifftOutput> output1(nblocks);
+	Array<SwifftOutput> operand(nblocks);
+	for (int b=0; b<nblocks; b++) {
+		int16_t *o = (int16_t *)output1.array[b].data, *p = (int16_t *)operand.array[b].data;
+		for (int j=0; j<SWIFFT_N; j++) {
+			o[j] = elements[(b*SWIFFT_N + j) % nelements];
+			p[j] = elements[(b*SWIFFT_N + j) / nelements % nelements];
+		}
+	}
+	for_each_supported_iset([&](const swifft_object_t & swifft, swifft_iset_t) {
+		Array<SwifftOutput> product(nblocks);
+		memcpy(product.array[0].data, output1.array[0].data, nblocks*sizeof(SwifftOutput));
+		swifft.arith.SWIFFT_Mul(product.array[0].data, operand.array[0].data);
+		swifft.arith.SWIFFT_MulMultiple(nblocks - 1, product.array[1].data, operand.array[1].data);
+		for (int b=0; b<nblocks; b++) {
+			const int16_t *o = (const int16_t *)output1.array[b].data, *p = (const int16_t *)operand.array[b].data;
+			const int16_t *r = (const int16_t *)product.array[b].data;
+			for (int j=0; j<SWIFFT_N; j++) {
+				CAPTURE( o[j], p[j] );
+				CHECK( r[j] == o[j] * p[j] % SWIFFT_P );
+			}
+		}
+		for (int k=0; k<nmultipliers; k++) {
+			CAPTURE( multipliers[k] );
+			int m = (multipliers[k] % SWIFFT_P + SWIFFT_P) % SWIFFT_P;
+			int16_t operands[nblocks] = {multipliers[k], multipliers[k]};
+			memcpy(product.array[0].data, output1.array[0].data, nblocks*sizeof(SwifftOutput));
+			swifft.arith.SWIFFT_ConstMul(product.array[0].data, multipliers[k]);
+			swifft.arith.SWIFFT_ConstMulMultiple(nblocks - 1, product.array[1].data, operands + 1);
+			for (int b=0; b<nblocks; b++) {
+				const int16_t *o = (const int16_t *)output1.array[b].data, *r = (const int16_t *)product.array[b].data;
+				for (int j=0; j<SWIFFT_N; j++) {
+					CAPTURE( o[j] );
+					CHECK( r[j] == o[j] * m % SWIFFT_P );
+				}
+			}
+		}
+	});
+}
+
 TEST_CASE( "swifft two-vectors operations compute correctly", "[swifft]" ) {
 #define TESTCODE(suffix) \
 	{ \
@@ -1136,15 +2095,10 @@ TEST_CASE( "swifft two-vectors operations compute correctly", "[swifft]" ) {
 		REQUIRE( output1 == output2 ); \
 	}
 	TESTCODE()
-#if defined(__AVX__)
-	TESTCODE(_AVX)
-#endif
-#if defined(__AVX2__)
-	TESTCODE(_AVX2)
-#endif
-#if defined(__AVX512F__)
-	TESTCODE(_AVX512)
-#endif
+	if (SWIFFT_IsIsetSupported(SWIFFT_ISET_AVX)) TESTCODE(_AVX)
+	if (SWIFFT_IsIsetSupported(SWIFFT_ISET_AVX2)) TESTCODE(_AVX2)
+	if (SWIFFT_IsIsetSupported(SWIFFT_ISET_AVX512)) TESTCODE(_AVX512)
+	if (SWIFFT_IsIsetSupported(SWIFFT_ISET_AVX512BW)) TESTCODE(_AVX512BW)
 #undef TESTCODE
 }
 
@@ -1266,4 +2220,528 @@ TEST_CASE( "swifft multiple compact computes correctly", "[swifft]" ) {
 	}
 }
 
+TEST_CASE( "swifft linear combination computes sums of products mod 257", "[swifft]" ) {
+	const int nmax = 2*16384 + 3; // enough for a reduction of the 32-bit sums, and odd
+	srand(1);
+	Array<SwifftInput> input(nmax);
+	Array<SwifftOutput> output(nmax);
+	std::vector<int16_t> coeffs(nmax);
+	randomize(input.array, nmax);
+	SWIFFT_ComputeMultiple(nmax, input.array[0].data, output.array[0].data);
+	for (int i=0; i<nmax; i++) {
+		// the extreme coefficients and hash values, which maximize the products, first
+		coeffs[i] = (i < 4) ? ((i & 1) ? INT16_MIN : 128) : (int16_t)rand();
+		if (i < 4) {
+			SWIFFT_ConstSet(output.array[i].data, SWIFFT_P-1);
+		}
+	}
+	for_each_supported_iset([&](const swifft_object_t & swifft, swifft_iset_t) {
+		for (int n : {0, 1, 2, 7, 100, nmax}) {
+			CAPTURE( n );
+			SwifftOutput expected, result;
+			int16_t *e = (int16_t *)expected.data;
+			for (int j=0; j<SWIFFT_N; j++) {
+				int64_t sum = 0;
+				for (int i=0; i<n; i++) {
+					sum += (int64_t)coeffs[i] * ((const int16_t *)output.array[i].data)[j];
+				}
+				e[j] = (int16_t)(((sum % SWIFFT_P) + SWIFFT_P) % SWIFFT_P);
+			}
+			swifft.arith.SWIFFT_LinearCombination(n, coeffs.data(), output.array[0].data, result.data);
+			CHECK( result == expected );
+		}
+		const int nblocks = 5, n = 9;
+		Array<SwifftOutput> results(nblocks);
+		swifft.arith.SWIFFT_LinearCombinationMultiple(nblocks, n, coeffs.data(), output.array[0].data, results.array[0].data);
+		for (int i=0; i<nblocks; i++) {
+			CAPTURE( i );
+			SwifftOutput result;
+			swifft.arith.SWIFFT_LinearCombination(n, coeffs.data() + i*n, output.array[i*n].data, result.data);
+			CHECK( results.array[i] == result );
+		}
+	});
+	SwifftOutput result, expected;
+	LinearCombination(result, 3, coeffs.data() + 4, &output.array[4]);
+	SWIFFT_LinearCombination(3, coeffs.data() + 4, output.array[4].data, expected.data);
+	CHECK( result == expected );
+}
+
+TEST_CASE( "swifft linear combination of canonicalized elements computes mod 257", "[swifft]" ) {
+	// an odd number of terms per block, enough for the products of non-canonical elements to overflow 32 bits
+	const int n = 2*256 + 89, nblocks = 3;
+	srand(1);
+	Array<SwifftInput> input(nblocks * n);
+	Array<SwifftOutput> operand(nblocks * n);
+	std::vector<int16_t> coeffs(nblocks * n);
+	randomize(input.array, nblocks * n);
+	SWIFFT_ComputeMultiple(nblocks * n, input.array[0].data, operand.array[0].data);
+	// elements anywhere in the range of int16_t, and the extreme elements and coefficients in the first block
+	for (int i=0; i<nblocks * n; i++) {
+		int16_t *v = (int16_t *)operand.array[i].data;
+		for (int j=0; j<SWIFFT_N; j++) {
+			v[j] = i < n ? INT16_MIN : v[j] + SWIFFT_P * (rand() % 252 - 127);
+		}
+		coeffs[i] = i < n ? 128 : (int16_t)rand();
+	}
+	Array<SwifftOutput> expected(nblocks);
+	for (int b=0; b<nblocks; b++) {
+		int16_t *e = (int16_t *)expected.array[b].data;
+		for (int j=0; j<SWIFFT_N; j++) {
+			int64_t sum = 0;
+			for (int i=b*n; i<(b+1)*n; i++) {
+				sum += (int64_t)coeffs[i] * ((const int16_t *)operand.array[i].data)[j];
+			}
+			e[j] = (int16_t)(((sum % SWIFFT_P) + SWIFFT_P) % SWIFFT_P);
+		}
+	}
+	for_each_supported_iset([&](const swifft_object_t & swifft, swifft_iset_t) {
+		Array<SwifftOutput> canonical(nblocks * n);
+		for (int i=0; i<nblocks * n; i++) {
+			canonical.array[i] = operand.array[i];
+		}
+		swifft.arith.SWIFFT_CanonicalizeMultiple(nblocks * n, canonical.array[0].data);
+		Array<SwifftOutput> results(nblocks);
+		swifft.arith.SWIFFT_LinearCombinationMultiple(nblocks, n, coeffs.data(), canonical.array[0].data, results.array[0].data);
+		for (int b=0; b<nblocks; b++) {
+			CAPTURE( b );
+			SwifftOutput result;
+			swifft.arith.SWIFFT_LinearCombination(n, coeffs.data() + b*n, canonical.array[b*n].data, result.data);
+			CHECK( result == expected.array[b] );
+			CHECK( results.array[b] == expected.array[b] );
+		}
+	});
+}
+
+TEST_CASE( "swifft matrix multiplication of outputs computes mod 257", "[swifft]" ) {
+	const int kmax = 29, nmax = 2*128 + 45; // several tiles of rows and columns, and partial ones
+	srand(1);
+	Array<SwifftInput> input(nmax);
+	Array<SwifftOutput> operand(nmax);
+	std::vector<int16_t> matrix(kmax * nmax);
+	randomize(input.array, nmax);
+	SWIFFT_ComputeMultiple(nmax, input.array[0].data, operand.array[0].data);
+	for (int j=0; j<nmax; j++) {
+		if (j % 3 == 0) {
+			SWIFFT_ConstSet(operand.array[j].data, SWIFFT_P-1);
+		}
+	}
+	for (size_t i=0; i<matrix.size(); i++) {
+		// the extreme coefficients, which maximize the sums of products, in the first row
+		matrix[i] = (i < nmax) ? ((i & 1) ? INT16_MIN : INT16_MIN + 1) : (int16_t)rand();
+	}
+	for_each_supported_iset([&](const swifft_object_t & swifft, swifft_iset_t) {
+		for (int k : {1, 4, kmax}) {
+			for (int n : {0, 1, 2, 127, 128, 129, nmax}) {
+				CAPTURE( k, n );
+				// the number of columns is the distance between rows, so the matrix is compacted for n
+				std::vector<int16_t> a((size_t)k * n);
+				for (int i=0; i<k; i++) {
+					for (int j=0; j<n; j++) {
+						a[(size_t)i*n+j] = matrix[(size_t)i*nmax+j];
+					}
+				}
+				Array<SwifftOutput> result(k);
+				swifft.arith.SWIFFT_MatMulOutputs(k, n, a.data(), operand.array[0].data, result.array[0].data);
+				for (int i=0; i<k; i++) {
+					CAPTURE( i );
+					SwifftOutput expected;
+					int16_t *e = (int16_t *)expected.data;
+					for (int l=0; l<SWIFFT_N; l++) {
+						int64_t sum = 0;
+						for (int j=0; j<n; j++) {
+							sum += (int64_t)a[(size_t)i*n+j] * ((const int16_t *)operand.array[j].data)[l];
+						}
+						e[l] = (int16_t)(((sum % SWIFFT_P) + SWIFFT_P) % SWIFFT_P);
+					}
+					CHECK( result.array[i] == expected );
+				}
+			}
+		}
+	});
+}
+
+TEST_CASE( "swifft coefficient form evaluates to the hash value", "[swifft]" ) {
+	const int nblocks = 29;
+	srand(1);
+	Array<SwifftInput> input(nblocks);
+	Array<SwifftOutput> output(nblocks);
+	randomize(input.array, nblocks);
+	SWIFFT_ComputeMultiple(nblocks, input.array[0].data, output.array[0].data);
+	SWIFFT_ConstSet(output.array[0].data, SWIFFT_P-1);
+	// the powers of the 128-th root of unity, which the i-th element of a hash value is evaluated at an odd power of
+	int omegaPowers[2*SWIFFT_N];
+	omegaPowers[0] = 1;
+	for (int e=1; e<2*SWIFFT_N; e++) {
+		omegaPowers[e] = omegaPowers[e-1] * 42 % SWIFFT_P;
+	}
+	for_each_supported_iset([&](const swifft_object_t & swifft, swifft_iset_t) {
+		for (int n : {1, 2, 3, 5, nblocks}) {
+			CAPTURE( n );
+			Array<SwifftOutput> coeffs(n);
+			for (int i=0; i<n; i++) {
+				coeffs.array[i] = output.array[i];
+			}
+			swifft.arith.SWIFFT_ToCoefficientsMultiple(n, coeffs.array[0].data);
+			for (int i=0; i<n; i++) {
+				CAPTURE( i );
+				const int16_t *c = (const int16_t *)coeffs.array[i].data;
+				SwifftOutput expected;
+				int16_t *e = (int16_t *)expected.data;
+				for (int q=0; q<SWIFFT_N; q++) {
+					int sum = 0;
+					for (int j=0; j<SWIFFT_N; j++) {
+						sum = (sum + c[j] * omegaPowers[(2*q+1)*j % (2*SWIFFT_N)]) % SWIFFT_P;
+					}
+					e[q] = sum;
+				}
+				CHECK( expected == output.array[i] );
+				SwifftOutput single;
+				single = output.array[i];
+				swifft.arith.SWIFFT_ToCoefficients(single.data);
+				CHECK( single == coeffs.array[i] );
+				swifft.arith.SWIFFT_FromCoefficients(single.data);
+				CHECK( single == output.array[i] );
+			}
+			swifft.arith.SWIFFT_FromCoefficientsMultiple(n, coeffs.array[0].data);
+			for (int i=0; i<n; i++) {
+				CAPTURE( i );
+				CHECK( coeffs.array[i] == output.array[i] );
+			}
+		}
+		// multiplying hash values is multiplying their polynomials mod x^64+1
+		SwifftOutput a, b, product;
+		a = output.array[1];
+		b = output.array[2];
+		product = output.array[1];
+		swifft.arith.SWIFFT_Mul(product.data, b.data);
+		swifft.arith.SWIFFT_ToCoefficients(a.data);
+		swifft.arith.SWIFFT_ToCoefficients(b.data);
+		swifft.arith.SWIFFT_ToCoefficients(product.data);
+		const int16_t *ac = (const int16_t *)a.data, *bc = (const int16_t *)b.data;
+		SwifftOutput expected;
+		int16_t *e = (int16_t *)expected.data;
+		for (int k=0; k<SWIFFT_N; k++) {
+			int sum = 0;
+			for (int j=0; j<SWIFFT_N; j++) {
+				int l = k - j;
+				int term = ac[j] * bc[l < 0 ? l + SWIFFT_N : l];
+				sum = (sum + (l < 0 ? SWIFFT_P - term % SWIFFT_P : term)) % SWIFFT_P;
+			}
+			e[k] = sum;
+		}
+		CHECK( product == expected );
+	});
+}
+
+TEST_CASE( "swifft equality and search compare mod 257 with non-canonical elements", "[swifft]" ) {
+	const int nblocks = 29;
+	srand(1);
+	Array<SwifftInput> input(nblocks);
+	Array<SwifftOutput> output(nblocks);
+	Array<SwifftOutput> noncanonical(nblocks);
+	Array<SwifftCompact> compact(nblocks);
+	Array<SwifftCompact> compact2(nblocks);
+	randomize(input.array, nblocks);
+	SWIFFT_ComputeMultiple(nblocks, input.array[0].data, output.array[0].data);
+	SWIFFT_CompactMultiple(nblocks, output.array[0].data, compact.array[0].data);
+	// the same values mod 257, anywhere in the range of int16_t, and with -1 and 256 alternating in the first block
+	for (int i=0; i<nblocks; i++) {
+		const int16_t *o = (const int16_t *)output.array[i].data;
+		int16_t *v = (int16_t *)noncanonical.array[i].data;
+		for (int j=0; j<SWIFFT_N; j++) {
+			v[j] = o[j] + SWIFFT_P * (rand() % 252 - 127);
+		}
+	}
+	int16_t *first = (int16_t *)noncanonical.array[0].data;
+	for (int j=0; j<SWIFFT_N; j++) {
+		first[j] = j % 2 == 0 ? -1 : 256;
+	}
+	SWIFFT_ConstSet(output.array[0].data, SWIFFT_P-1);
+	// every third block differs in one element, with a non-canonical value
+	Array<SwifftOutput> different(nblocks);
+	for (int i=0; i<nblocks; i++) {
+		different.array[i] = noncanonical.array[i];
+		compact2.array[i] = compact.array[i];
+		if (i % 3 == 1) {
+			((int16_t *)different.array[i].data)[i % SWIFFT_N] += SWIFFT_P + 1;
+			compact2.array[i].data[i % SWIFFT_COMPACT_BLOCK_SIZE] ^= 1;
+		}
+	}
+	for_each_supported_iset([&](const swifft_object_t & swifft, swifft_iset_t) {
+		for (int n : {1, 7, 8, 9, nblocks}) {
+			CAPTURE( n );
+			BitSequence equal[(nblocks + 7) / 8], compactEqual[(nblocks + 7) / 8];
+			memset(equal, 0xff, sizeof(equal));
+			memset(compactEqual, 0xff, sizeof(compactEqual));
+			swifft.arith.SWIFFT_EqualMultiple(n, output.array[0].data, different.array[0].data, equal);
+			swifft.hash.SWIFFT_CompactEqualMultiple(n, compact.array[0].data, compact2.array[0].data, compactEqual);
+			for (int i=0; i<(n + 7) / 8 * 8; i++) {
+				CAPTURE( i );
+				int expected = i < n && i % 3 != 1;
+				CHECK( ((equal[i / 8] >> (i % 8)) & 1) == expected );
+				CHECK( ((compactEqual[i / 8] >> (i % 8)) & 1) == expected );
+				if (i < n) {
+					CHECK( swifft.arith.SWIFFT_Equal(output.array[i].data, different.array[i].data) == expected );
+					CHECK( swifft.arith.SWIFFT_Equal(noncanonical.array[i].data, output.array[i].data) == 1 );
+				}
+			}
+			Array<SwifftOutput> canonical(n);
+			for (int i=0; i<n; i++) {
+				canonical.array[i] = noncanonical.array[i];
+			}
+			swifft.arith.SWIFFT_CanonicalizeMultiple(n, canonical.array[0].data);
+			for (int i=0; i<n; i++) {
+				CAPTURE( i );
+				CHECK( canonical.array[i] == output.array[i] );
+				SwifftOutput single;
+				single = noncanonical.array[i];
+				swifft.arith.SWIFFT_Canonicalize(single.data);
+				CHECK( single == output.array[i] );
+			}
+		}
+		for (int i=0; i<nblocks; i++) {
+			CAPTURE( i );
+			CHECK( swifft.arith.SWIFFT_FindMatch(nblocks, noncanonical.array[0].data, output.array[i].data) == i );
+			CHECK( swifft.arith.SWIFFT_FindMatch(nblocks, output.array[0].data, noncanonical.array[i].data) == i );
+			CHECK( swifft.arith.SWIFFT_FindMatch(i, output.array[0].data, output.array[i].data) == -1 );
+			CHECK( swifft.hash.SWIFFT_FindCompactMatch(nblocks, compact.array[0].data, compact.array[i].data) == i );
+			CHECK( swifft.hash.SWIFFT_FindCompactMatch(i, compact.array[0].data, compact.array[i].data) == -1 );
+			int found = swifft.arith.SWIFFT_FindMatch(nblocks, output.array[0].data, different.array[i].data);
+			CHECK( found == (i % 3 != 1 ? i : -1) );
+			found = swifft.hash.SWIFFT_FindCompactMatch(nblocks, compact.array[0].data, compact2.array[i].data);
+			CHECK( found == (i % 3 != 1 ? i : -1) );
+		}
+		// the first of repeated blocks is found
+		Array<SwifftOutput> repeated(nblocks);
+		for (int i=0; i<nblocks; i++) {
+			repeated.array[i] = output.array[i % 5];
+		}
+		CHECK( swifft.arith.SWIFFT_FindMatch(nblocks, repeated.array[0].data, noncanonical.array[3].data) == 3 );
+		CHECK( swifft.arith.SWIFFT_FindMatch(nblocks - 5, repeated.array[5].data, output.array[4].data) == 4 );
+	});
+}
+
+TEST_CASE( "swifft sum and product of multiple blocks compute mod 257", "[swifft]" ) {
+	const int nmax = 3*256 + 5; // several chunks and a partial one
+	srand(1);
+	Array<SwifftInput> input(nmax);
+	Array<SwifftOutput> output(nmax);
+	randomize(input.array, nmax);
+	SWIFFT_ComputeMultiple(nmax, input.array[0].data, output.array[0].data);
+	for (int i=0; i<nmax; i++) {
+		int16_t *e = (int16_t *)output.array[i].data;
+		for (int j=0; j<SWIFFT_N; j++) {
+			// avoid zeros, which would make most products zero, and include the extreme elements
+			e[j] = (i % 11 == 0) ? SWIFFT_P-1 : (i % 13 == 0) ? SWIFFT_P/2 + 1 : (e[j] == 0) ? 1 : e[j];
+		}
+	}
+	for_each_supported_iset([&](const swifft_object_t & swifft, swifft_iset_t) {
+		for (int n : {0, 1, 2, 256, nmax}) {
+			CAPTURE( n );
+			SwifftOutput expectedSum, expectedProduct, sum, product, chained;
+			int16_t *es = (int16_t *)expectedSum.data;
+			int16_t *ep = (int16_t *)expectedProduct.data;
+			for (int j=0; j<SWIFFT_N; j++) {
+				int64_t s = 0, p = 1;
+				for (int i=0; i<n; i++) {
+					int16_t e = ((const int16_t *)output.array[i].data)[j];
+					s = (s + e) % SWIFFT_P;
+					p = (p * e) % SWIFFT_P;
+				}
+				es[j] = (int16_t)s;
+				ep[j] = (int16_t)p;
+			}
+			swifft.arith.SWIFFT_SumMultiple(n, output.array[0].data, sum.data);
+			CHECK( sum == expectedSum );
+			swifft.arith.SWIFFT_ProductMultiple(n, output.array[0].data, product.data);
+			CHECK( product == expectedProduct );
+			swifft.arith.SWIFFT_ConstSet(chained.data, 1);
+			for (int i=0; i<n; i++) {
+				swifft.arith.SWIFFT_Mul(chained.data, output.array[i].data);
+			}
+			CHECK( chained == expectedProduct );
+		}
+	});
+}
+
+TEST_CASE( "swifft fused multiply-add operations compute mod 257", "[swifft]" ) {
+	const int nblocks = 25; // more than the default threshold for parallelizing over blocks
+	srand(1);
+	Array<SwifftInput> input(3*nblocks);
+	Array<SwifftOutput> operand(3*nblocks);
+	std::vector<int16_t> multiplier(nblocks);
+	randomize(input.array, 3*nblocks);
+	SWIFFT_ComputeMultiple(3*nblocks, input.array[0].data, operand.array[0].data);
+	for (int i=0; i<3*nblocks; i++) {
+		int16_t *e = (int16_t *)operand.array[i].data;
+		for (int j=0; j<SWIFFT_N; j++) {
+			// include the extreme elements, whose products maximize the sums
+			e[j] = (i % 5 == 0) ? SWIFFT_P-1 : (i % 7 == 0) ? SWIFFT_P/2 + 1 : e[j];
+		}
+	}
+	for (int i=0; i<nblocks; i++) {
+		multiplier[i] = (i < 2) ? ((i & 1) ? INT16_MIN : INT16_MAX) : (int16_t)rand();
+	}
+	const SwifftOutput *output = operand.array, *operand1 = operand.array + nblocks, *operand2 = operand.array + 2*nblocks;
+	Array<SwifftOutput> expectedMulAdd(nblocks), expectedMulSub(nblocks), expectedConstMulAdd(nblocks), expectedConstMulSub(nblocks);
+	for (int i=0; i<nblocks; i++) {
+		for (int j=0; j<SWIFFT_N; j++) {
+			int32_t o = ((const int16_t *)output[i].data)[j];
+			int32_t a = ((const int16_t *)operand1[i].data)[j];
+			int32_t b = ((const int16_t *)operand2[i].data)[j];
+			((int16_t *)expectedMulAdd.array[i].data)[j] = (int16_t)((o + a*b) % SWIFFT_P);
+			((int16_t *)expectedMulSub.array[i].data)[j] = (int16_t)(((o - a*b) % SWIFFT_P + SWIFFT_P) % SWIFFT_P);
+			((int16_t *)expectedConstMulAdd.array[i].data)[j] = (int16_t)(((o + a*multiplier[i]) % SWIFFT_P + SWIFFT_P) % SWIFFT_P);
+			((int16_t *)expectedConstMulSub.array[i].data)[j] = (int16_t)(((o - a*multiplier[i]) % SWIFFT_P + SWIFFT_P) % SWIFFT_P);
+		}
+	}
+	for_each_supported_iset([&](const swifft_object_t & swifft, swifft_iset_t) {
+		Array<SwifftOutput> result(nblocks);
+		for (int i=0; i<nblocks; i++) {
+			CAPTURE( i );
+			result.array[i] = output[i];
+			swifft.arith.SWIFFT_MulAdd(result.array[i].data, operand1[i].data, operand2[i].data);
+			CHECK( result.array[i] == expectedMulAdd.array[i] );
+			result.array[i] = output[i];
+			swifft.arith.SWIFFT_MulSub(result.array[i].data, operand1[i].data, operand2[i].data);
+			CHECK( result.array[i] == expectedMulSub.array[i] );
+			result.array[i] = output[i];
+			swifft.arith.SWIFFT_ConstMulAdd(result.array[i].data, operand1[i].data, multiplier[i]);
+			CHECK( result.array[i] == expectedConstMulAdd.array[i] );
+			result.array[i] = output[i];
+			swifft.arith.SWIFFT_ConstMulSub(result.array[i].data, operand1[i].data, multiplier[i]);
+			CHECK( result.array[i] == expectedConstMulSub.array[i] );
+		}
+		SWIFFT_SetMultiple(nblocks, result.array[0].data, output[0].data);
+		swifft.arith.SWIFFT_MulAddMultiple(nblocks, result.array[0].data, operand1[0].data, operand2[0].data);
+		for (int i=0; i<nblocks; i++) {
+			CHECK( result.array[i] == expectedMulAdd.array[i] );
+		}
+		SWIFFT_SetMultiple(nblocks, result.array[0].data, output[0].data);
+		swifft.arith.SWIFFT_MulSubMultiple(nblocks, result.array[0].data, operand1[0].data, operand2[0].data);
+		for (int i=0; i<nblocks; i++) {
+			CHECK( result.array[i] == expectedMulSub.array[i] );
+		}
+		SWIFFT_SetMultiple(nblocks, result.array[0].data, output[0].data);
+		swifft.arith.SWIFFT_ConstMulAddMultiple(nblocks, result.array[0].data, operand1[0].data, multiplier.data());
+		for (int i=0; i<nblocks; i++) {
+			CHECK( result.array[i] == expectedConstMulAdd.array[i] );
+		}
+		SWIFFT_SetMultiple(nblocks, result.array[0].data, output[0].data);
+		swifft.arith.SWIFFT_ConstMulSubMultiple(nblocks, result.array[0].data, operand1[0].data, multiplier.data());
+		for (int i=0; i<nblocks; i++) {
+			CHECK( result.array[i] == expectedConstMulSub.array[i] );
+		}
+	});
+	SwifftOutput result;
+	result = output[0];
+	result += operand1[0] * operand2[0];
+	CHECK( result == expectedMulAdd.array[0] );
+	result = output[0];
+	result -= operand1[0] * operand2[0];
+	CHECK( result == expectedMulSub.array[0] );
+	result = output[0];
+	result += multiplier[0] * operand1[0];
+	CHECK( result == expectedConstMulAdd.array[0] );
+	result = output[0];
+	result += operand1[0] * multiplier[0];
+	CHECK( result == expectedConstMulAdd.array[0] );
+	result = output[0];
+	result -= multiplier[0] * operand1[0];
+	CHECK( result == expectedConstMulSub.array[0] );
+}
+
+TEST_CASE( "swifft broadcast and outer-product operations are consistent with single blocks", "[swifft]" ) {
+	const int nblocks = 25; // more than the default threshold for parallelizing over blocks
+	srand(1);
+	Array<SwifftInput> input(nblocks+1);
+	Array<SwifftOutput> output(nblocks+1);
+	std::vector<int16_t> multiplier(nblocks);
+	randomize(input.array, nblocks+1);
+	SWIFFT_ComputeMultiple(nblocks+1, input.array[0].data, output.array[0].data);
+	for (int i=0; i<nblocks; i++) {
+		multiplier[i] = (i < 2) ? ((i & 1) ? INT16_MIN : INT16_MAX) : (int16_t)rand();
+	}
+	const SwifftOutput &operand = output.array[nblocks];
+	for_each_supported_iset([&](const swifft_object_t & swifft, swifft_iset_t) {
+		Array<SwifftOutput> result(nblocks);
+		SwifftOutput expected;
+#define TEST_CODE(op) \
+		SWIFFT_SetMultiple(nblocks, result.array[0].data, output.array[0].data); \
+		swifft.arith.SWIFFT_##op##Broadcast(nblocks, result.array[0].data, operand.data); \
+		for (int i=0; i<nblocks; i++) { \
+			CAPTURE( i ); \
+			expected = output.array[i]; \
+			swifft.arith.SWIFFT_##op(expected.data, operand.data); \
+			CHECK( result.array[i] == expected ); \
+		}
+		TEST_CODE(Set)
+		TEST_CODE(Add)
+		TEST_CODE(Sub)
+		TEST_CODE(Mul)
+#undef TEST_CODE
+		swifft.arith.SWIFFT_ConstMulOuter(nblocks, result.array[0].data, operand.data, multiplier.data());
+		for (int i=0; i<nblocks; i++) {
+			CAPTURE( i );
+			expected = operand;
+			swifft.arith.SWIFFT_ConstMul(expected.data, multiplier[i]);
+			CHECK( result.array[i] == expected );
+		}
+	});
+}
+
+TEST_CASE( "swifft accumulator sums consistently with add and sub", "[swifft]" ) {
+	const int n = 1000; // enough for several reductions of the accumulator
+	srand(1);
+	Array<SwifftInput> input(n);
+	Array<SwifftOutput> output(n);
+	randomize(input.array, n);
+	SWIFFT_ComputeMultiple(n, input.array[0].data, output.array[0].data);
+	for (int i=0; i<n; i+=7) {
+		// the maximal element, which uses up headroom fastest
+		SWIFFT_ConstSet(output.array[i].data, SWIFFT_P-1);
+	}
+	for_each_supported_iset([&](const swifft_object_t & swifft, swifft_iset_t) {
+		SWIFFT_ALIGN swifft_accumulator_t accumulator;
+		SwifftOutput expected, sum;
+		swifft.arith.SWIFFT_AccumulatorInit(&accumulator);
+		expected = 0;
+		for (int i=0; i<n; i++) {
+			// add all but a few, so that the unreduced sum grows
+			bool sub = (i % 5 == 4);
+			(sub ? swifft.arith.SWIFFT_AccumulatorSub : swifft.arith.SWIFFT_AccumulatorAdd)(&accumulator, output.array[i].data);
+			(sub ? swifft.arith.SWIFFT_Sub : swifft.arith.SWIFFT_Add)(expected.data, output.array[i].data);
+		}
+		swifft.arith.SWIFFT_AccumulatorGet(&accumulator, sum.data);
+		CHECK( sum == expected );
+		swifft.arith.SWIFFT_AccumulatorSubMultiple(&accumulator, n, output.array[0].data);
+		swifft.arith.SWIFFT_AccumulatorSubMultiple(&accumulator, n, output.array[0].data);
+		swifft.arith.SWIFFT_AccumulatorAddMultiple(&accumulator, n/2, output.array[0].data);
+		for (int i=0; i<n; i++) {
+			swifft.arith.SWIFFT_Sub(expected.data, output.array[i].data);
+			swifft.arith.SWIFFT_Sub(expected.data, output.array[i].data);
+		}
+		for (int i=0; i<n/2; i++) {
+			swifft.arith.SWIFFT_Add(expected.data, output.array[i].data);
+		}
+		swifft.arith.SWIFFT_AccumulatorGet(&accumulator, sum.data);
+		CHECK( sum == expected );
+	});
+	SwifftAccumulator accumulator;
+	SwifftOutput expected, sum;
+	expected = 0;
+	for (int i=0; i<n; i++) {
+		accumulator += output.array[i];
+		expected += output.array[i];
+	}
+	accumulator -= output.array[0];
+	expected -= output.array[0];
+	accumulator.Get(sum);
+	CHECK( sum == expected );
+	accumulator.Clear();
+	accumulator.Get(sum);
+	expected = 0;
+	CHECK( sum == expected );
+}
+
 } // end namespace LibSwifft